@@ -144,7 +144,7 @@ echo ""
 
 # For demonstration, run a memory stress test instead
 echo -e "${YELLOW}Running memory stress test via SystemC...${NC}"
-echo "Note: Test client has been optimized with request pacing to prevent queue overflow"
+echo "Note: Test client stays within the server's flow-control credits, so the model's queues cannot overflow"
 echo "Waiting for server to be ready for new connection..."
 sleep 2
 ../systemc_bridge/test_client --server 127.0.0.1:$SYSTEMC_PORT --test performance
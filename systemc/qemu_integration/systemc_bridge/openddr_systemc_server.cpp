@@ -1,4 +1,6 @@
 #include "qemu_systemc_bridge.h"
+#include "openddr_log.h"
+#include "openddr_seed.h"
 #include <iostream>
 #include <signal.h>
 #include <getopt.h>
@@ -7,7 +9,7 @@
 #include <chrono>
 
 // Global server instance for signal handling
-openddrSystemCServer* g_server = nullptr;
+OpenDDRSystemCServer* g_server = nullptr;
 
 // Signal handler for graceful shutdown
 void signal_handler(int signal) {
@@ -30,8 +32,16 @@ void print_usage(const char* program_name) {
     std::cout << "  -m, --memory-size SIZE   Memory size in MB (default: 1024)" << std::endl;
     std::cout << "  -a, --arch ARCH          Target architecture (default: arm64)" << std::endl;
     std::cout << "  -t, --trace-file FILE    VCD trace file (default: none)" << std::endl;
-    std::cout << "  -l, --log-file FILE      Log file (default: stdout)" << std::endl;
-    std::cout << "  -v, --verbose            Verbose output" << std::endl;
+    std::cout << "  -l, --log-file FILE      Binary model event log, see openddr_log_fmt (default: text to stdout)" << std::endl;
+    std::cout << "  -s, --slice NS           Simulated time per simulation slice in ns (default: 1000)" << std::endl;
+    std::cout << "  -q, --quantum NS         Old name of --slice" << std::endl;
+    std::cout << "  -u, --unix-socket PATH   Also listen on an AF_UNIX socket (accepts a guest RAM memfd)" << std::endl;
+    std::cout << "  -r, --reactors N         Socket event loop threads (default: 2)" << std::endl;
+    std::cout << "  -M, --metrics ADDR       Prometheus metrics on 127.0.0.1:ADDR, or on socket path ADDR" << std::endl;
+    std::cout << "  -b, --heartbeat MS       Advance the idle simulation every MS ms for VCD activity (default: off)" << std::endl;
+    std::cout << "  -T, --timed              Run requests through the model's AXI ports and report their latency" << std::endl;
+    std::cout << "  -e, --seed N             Global random seed (default: OPENDDR_SEED or " << OpenDDRSeed::DEFAULT_SEED << ")" << std::endl;
+    std::cout << "  -v, --verbose            Verbose output (DEBUG level model events)" << std::endl;
     std::cout << "  -d, --daemon             Run as daemon" << std::endl;
     std::cout << "  -h, --help               Show this help" << std::endl;
     std::cout << std::endl;
@@ -51,6 +61,12 @@ int sc_main(int argc, char* argv[]) {
     std::string log_file = "";
     bool verbose = false;
     bool daemon = false;
+    uint64_t slice_ns = 1000;
+    bool timed = false;
+    std::string unix_socket = "";
+    int reactors = 2;
+    uint64_t heartbeat_ms = 0;
+    std::string metrics = "";
     
     // Command line options
     static struct option long_options[] = {
@@ -59,6 +75,14 @@ int sc_main(int argc, char* argv[]) {
         {"arch",        required_argument, 0, 'a'},
         {"trace-file",  required_argument, 0, 't'},
         {"log-file",    required_argument, 0, 'l'},
+        {"slice",       required_argument, 0, 's'},
+        {"quantum",     required_argument, 0, 'q'},  // Old name of --slice
+        {"seed",        required_argument, 0, 'e'},
+        {"timed",       no_argument,       0, 'T'},
+        {"unix-socket", required_argument, 0, 'u'},
+        {"reactors",    required_argument, 0, 'r'},
+        {"heartbeat",   required_argument, 0, 'b'},
+        {"metrics",     required_argument, 0, 'M'},
         {"verbose",     no_argument,       0, 'v'},
         {"daemon",      no_argument,       0, 'd'},
         {"help",        no_argument,       0, 'h'},
@@ -68,7 +92,10 @@ int sc_main(int argc, char* argv[]) {
     int option_index = 0;
     int c;
     
-    while ((c = getopt_long(argc, argv, "p:m:a:t:l:vdh", long_options, &option_index)) != -1) {
+    // --seed overrides OPENDDR_SEED; the model derives its streams from it
+    OpenDDRSeed::configure_from_env();
+    
+    while ((c = getopt_long(argc, argv, "p:m:a:t:l:s:q:e:Tu:r:b:M:vdh", long_options, &option_index)) != -1) {
         switch (c) {
             case 'p':
                 port = std::atoi(optarg);
@@ -103,6 +130,55 @@ int sc_main(int argc, char* argv[]) {
                 log_file = optarg;
                 break;
                 
+            case 's':
+            case 'q':
+                slice_ns = std::strtoull(optarg, nullptr, 10);
+                if (slice_ns == 0) {
+                    std::cerr << "Error: Invalid slice: " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+                
+            case 'e': {
+                uint64_t seed;
+                if (!OpenDDRSeed::parse(optarg, seed)) {
+                    std::cerr << "Error: Invalid seed: " << optarg << std::endl;
+                    return 1;
+                }
+                OpenDDRSeed::set_global(seed);
+                break;
+            }
+                
+            case 'T':
+                timed = true;
+                break;
+                
+            case 'u':
+                unix_socket = optarg;
+                break;
+                
+            case 'r':
+                reactors = std::atoi(optarg);
+                if (reactors <= 0) {
+                    std::cerr << "Error: Invalid reactor thread count: " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+                
+            case 'b': {
+                char* end;
+                heartbeat_ms = std::strtoull(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0') {
+                    std::cerr << "Error: Invalid heartbeat interval: " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+            }
+                
+            case 'M':
+                metrics = optarg;
+                break;
+                
             case 'v':
                 verbose = true;
                 break;
@@ -138,18 +214,47 @@ int sc_main(int argc, char* argv[]) {
     if (!log_file.empty()) {
         std::cout << "  Log File:     " << log_file << std::endl;
     }
+    std::cout << "  Slice:        " << slice_ns << " ns" << std::endl;
+    std::cout << "  Seed:         " << OpenDDRSeed::global() << std::endl;
+    std::cout << "  Timed:        " << (timed ? "Yes" : "No") << std::endl;
+    if (!unix_socket.empty()) {
+        std::cout << "  Unix Socket:  " << unix_socket << std::endl;
+    }
+    std::cout << "  Reactors:     " << reactors << std::endl;
+    if (!metrics.empty()) {
+        std::cout << "  Metrics:      " << metrics << std::endl;
+    }
+    if (heartbeat_ms > 0) {
+        std::cout << "  Heartbeat:    " << heartbeat_ms << " ms" << std::endl;
+    }
     std::cout << "  Verbose:      " << (verbose ? "Yes" : "No") << std::endl;
     std::cout << "  Daemon:       " << (daemon ? "Yes" : "No") << std::endl;
     std::cout << std::endl;
     
+    // Model event logging: environment first, command line overrides
+    OpenDDRLog::configure_from_env();
+    if (verbose) {
+        OpenDDRLog::set_level(OpenDDRLog::LVL_DEBUG);
+    }
+    if (!log_file.empty() && !OpenDDRLog::start_binary_sink(log_file)) {
+        std::cerr << "Error: Cannot open log file: " << log_file << std::endl;
+        return 1;
+    }
+    
     // Setup signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
     
     try {
         // Create and start server
-        openddrSystemCServer server(port, memory_size, architecture);
+        OpenDDRSystemCServer server(port, memory_size, architecture);
         g_server = &server;
+        server.set_slice(sc_time(static_cast<double>(slice_ns), SC_NS));
+        server.set_timed(timed);
+        server.set_unix_socket(unix_socket);
+        server.set_reactor_threads(reactors);
+        server.set_heartbeat(std::chrono::milliseconds(heartbeat_ms));
+        server.set_metrics_address(metrics);
         
         // Setup tracing if trace file is specified
         if (!trace_file.empty()) {
@@ -169,6 +274,7 @@ int sc_main(int argc, char* argv[]) {
         return 1;
     }
     
+    OpenDDRLog::stop_binary_sink();
     std::cout << "Server shutdown complete." << std::endl;
     return 0;
 }
@@ -10,75 +10,25 @@
 #include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <map>
+#include <vector>
+#include <functional>
+#include <future>
+#include <chrono>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <cstring>
 
-// Include the enhanced Whitney model
-#include "../src/whitney_systemc_model_enhanced.h"
-
-// Protocol definitions for QEMU-SystemC communication
-namespace QemuSystemC {
-
-// Message types
-enum MessageType {
-    MSG_READ_REQUEST = 1,
-    MSG_READ_RESPONSE = 2,
-    MSG_WRITE_REQUEST = 3,
-    MSG_WRITE_RESPONSE = 4,
-    MSG_INIT_REQUEST = 5,
-    MSG_INIT_RESPONSE = 6,
-    MSG_STATUS_REQUEST = 7,
-    MSG_STATUS_RESPONSE = 8,
-    MSG_SHUTDOWN = 9
-};
-
-// Message header
-struct MessageHeader {
-    uint32_t type;
-    uint32_t length;
-    uint64_t transaction_id;
-    uint64_t timestamp;
-} __attribute__((packed));
-
-// Memory access request
-struct MemoryRequest {
-    uint64_t address;
-    uint32_t size;
-    uint32_t access_type;  // 0=read, 1=write
-    uint8_t data[64];      // Maximum data size
-} __attribute__((packed));
-
-// Memory access response
-struct MemoryResponse {
-    uint64_t address;
-    uint32_t size;
-    uint32_t status;       // 0=success, 1=error
-    uint8_t data[64];      // Response data
-} __attribute__((packed));
-
-// System initialization request
-struct InitRequest {
-    uint64_t memory_size;
-    uint32_t page_size;
-    uint32_t cache_line_size;
-    char arch_name[32];
-} __attribute__((packed));
-
-// System status response
-struct StatusResponse {
-    uint64_t total_reads;
-    uint64_t total_writes;
-    uint64_t total_errors;
-    uint64_t current_bandwidth;
-    uint32_t active_banks;
-    uint32_t page_hits;
-    uint32_t page_misses;
-} __attribute__((packed));
-
-} // namespace QemuSystemC
+// Enhanced model with verification compiled out
+#include "openddr_systemc_model_verification_disabled.h"
+#include "qemu_systemc_protocol.h"
+#include "qemu_systemc_shm.h"
+#include "qemu_systemc_queue.h"
+#include "qemu_systemc_request_channel.h"
+#include "qemu_systemc_histogram.h"
+#include "qemu_systemc_metrics.h"
 
 // Main bridge class
 class QemuSystemCBridge : public sc_module {
@@ -93,6 +43,9 @@ public:
     // Main interface methods
     void start_server();
     void stop_server();
+    void set_unix_socket_path(const std::string& path) { unix_socket_path = path; }
+    void set_reactor_threads(int count) { reactor_threads = std::max(1, count); }
+    void set_metrics_address(const std::string& address) { metrics_address = address; }
     bool is_running() const { return server_running.load(); }
 
     // Memory interface methods
@@ -102,41 +55,171 @@ public:
     // Statistics and monitoring
     void print_statistics();
     QemuSystemC::StatusResponse get_status();
+    QemuSystemC::ExtStatusResponse get_ext_status();
+    
+    // Copies the model's counters for status requests; called by the
+    // simulation thread between sc_start slices
+    void publish_model_statistics();
+    
+    // Prometheus text for the metrics endpoint; any thread
+    std::string render_metrics();
     
     // Tracing support
     void setup_tracing(const std::string& trace_filename);
     void close_tracing();
+    
+    // Simulated time the simulation thread runs per sc_start slice; requests
+    // still reach the model mid-slice through the request channel
+    void set_slice(const sc_time& length);
+    const sc_time& get_slice() const { return slice; }
+    
+    // Timed mode: requests go through the model's AXI ports instead of the
+    // backing store, and responses carry the simulated latency
+    void set_timed(bool timed) { timed_mode = timed; }
+    bool is_timed() const { return timed_mode; }
+    
+    // Sleeping and waking the OS thread that runs the kernel
+    bool wait_for_pending_work(std::chrono::milliseconds timeout);
+    void wake_simulation();
 
 private:
+    struct Reactor;
+    
+    // A client connection: its socket and, once TRANSPORT_SHM_RING is
+    // negotiated, the rings that carry its messages instead.  Shared with
+    // the accesses still in flight, which may outlive its handler.
+    struct Connection : std::enable_shared_from_this<Connection> {
+        int socket = -1;
+        Reactor* reactor = nullptr;        // Serving reactor; nullptr once closed or on a ring
+        std::unique_ptr<QemuSystemC::ShmRegion> shm;
+        int passed_fd = -1;                // SCM_RIGHTS fd of the message being handled
+        uint8_t* guest_ram = nullptr;      // MSG_MEMFD_ATTACH mapping, see MemfdAttachRequest
+        uint64_t guest_base = 0;
+        uint64_t guest_size = 0;
+        
+        // Received bytes not yet parsed into messages: [rx_begin, rx_end)
+        std::vector<uint8_t> rx;
+        size_t rx_begin = 0;
+        size_t rx_end = 0;
+        
+        // Responses are queued as encoded frames, for the reactor or (on a
+        // ring with TRANSPORT_PIPELINED) the writer thread to send at once
+        bool pipelined = false;
+        bool variable_payload = false;       // TRANSPORT_VARIABLE_PAYLOAD responses
+        std::thread writer;
+        std::mutex tx_mutex;
+        std::condition_variable tx_cv;       // Writer: frames queued or closing
+        std::condition_variable slots_cv;    // Reader: in_flight dropped
+        std::vector<uint8_t> tx;
+        bool tx_closing = false;
+        int in_flight = 0;                   // Dispatched accesses not yet answered
+        
+        // Reactor thread only: frames taken from tx and not yet fully sent,
+        // and the epoll events currently registered
+        std::vector<uint8_t> out;
+        size_t out_offset = 0;
+        uint32_t events = 0;
+        
+        ~Connection();
+        
+        // The mapped guest RAM holding [address, address + size), or nullptr
+        uint8_t* guest_ram_at(uint64_t address, uint32_t size) const {
+            if (guest_ram == nullptr || address < guest_base || address - guest_base > guest_size ||
+                size > guest_size - (address - guest_base)) {
+                return nullptr;
+            }
+            return guest_ram + (address - guest_base);
+        }
+    };
+    
+    // An epoll thread serving many non-blocking connections.  Completions
+    // from the simulation thread post their connection and ring wake_fd.
+    struct Reactor {
+        int epoll_fd = -1;
+        int wake_fd = -1;                            // eventfd
+        std::atomic<bool> wake_pending{false};
+        std::thread thread;
+        QemuSystemC::MpscQueue<std::shared_ptr<Connection>> posted;
+        std::unordered_map<int, std::shared_ptr<Connection>> connections;  // By socket, reactor thread only
+        
+        void post(const std::shared_ptr<Connection>& conn);
+    };
+    
     // SystemC processes
-    void server_process();
-    void client_handler_process();
     void memory_interface_process();
     void initialization_process();
 
     // Network handling
     void setup_server_socket();
-    void handle_client_connection(int client_socket);
-    void process_message(int client_socket, const QemuSystemC::MessageHeader& header, 
-                        const std::vector<uint8_t>& data);
+    void reactor_loop(Reactor& reactor);
+    void accept_connections(Reactor& reactor, int listener);
+    void service_connection(Reactor& reactor, const std::shared_ptr<Connection>& conn, bool readable);
+    int read_socket(Connection& conn);
+    int take_message(Connection& conn, QemuSystemC::MessageHeader& header, const uint8_t*& payload);
+    bool admits_next_message(Connection& conn);
+    bool flush_connection(Connection& conn);
+    void update_events(Reactor& reactor, Connection& conn, uint32_t events);
+    void close_connection(Reactor& reactor, const std::shared_ptr<Connection>& conn);
+    void hand_off_to_ring(Reactor& reactor, const std::shared_ptr<Connection>& conn);
+    void serve_ring_connection(std::shared_ptr<Connection> conn, std::vector<uint8_t> pending);
+    bool dispatches_async(const Connection& conn) const { return timed_mode && (conn.pipelined || conn.reactor); }
+    void process_message(Connection& conn, const QemuSystemC::MessageHeader& header,
+                         const uint8_t* data, size_t size);
     
     // Message handlers
-    void handle_read_request(int client_socket, uint64_t transaction_id, 
-                           const QemuSystemC::MemoryRequest& request);
-    void handle_write_request(int client_socket, uint64_t transaction_id,
-                            const QemuSystemC::MemoryRequest& request);
-    void handle_init_request(int client_socket, uint64_t transaction_id,
+    void handle_access_request(Connection& conn, uint64_t transaction_id, bool is_write,
+                               const QemuSystemC::AccessRequest& request,
+                               const uint8_t* payload, size_t payload_size);
+    void handle_init_request(Connection& conn, uint64_t transaction_id,
                            const QemuSystemC::InitRequest& request);
-    void handle_status_request(int client_socket, uint64_t transaction_id);
+    void handle_status_request(Connection& conn, uint64_t transaction_id);
+    void handle_ext_status_request(Connection& conn, uint64_t transaction_id);
+    void handle_memfd_attach(Connection& conn, uint64_t transaction_id,
+                             const QemuSystemC::MemfdAttachRequest& request);
+    void handle_batch_request(Connection& conn, uint64_t transaction_id,
+                              const QemuSystemC::BatchHeader& batch,
+                              const QemuSystemC::BatchRequestRecord* records);
+    uint32_t execute_access(Connection& conn, bool is_write, uint64_t address, uint32_t size,
+                            const uint8_t* write_data, uint8_t* read_data, uint64_t& latency_ps);
+    void record_latency(bool is_write, uint32_t status, uint64_t latency_ps,
+                        std::chrono::steady_clock::time_point started);
+    
+    // Response layouts an access outcome is recorded in
+    enum ReplyFormat {
+        REPLY_MEMORY,      // MemoryResponse
+        REPLY_ACCESS,      // AccessResponse + read data (TRANSPORT_VARIABLE_PAYLOAD)
+        REPLY_BATCH        // BatchHeader + BatchResponseRecord[]
+    };
+    static std::vector<uint8_t> prepare_reply(ReplyFormat format, uint64_t address, uint32_t size);
+    static void fill_reply(ReplyFormat format, std::vector<uint8_t>& reply, uint32_t slot, uint32_t status,
+                           uint64_t latency_ps, const uint8_t* read_data, uint32_t read_size);
+    
+    // Pipelined timed accesses: dispatched without waiting, answered by the
+    // writer thread once the model responds
+    struct PipelinedAccess {
+        uint32_t slot;                 // Record index in a batch response, else 0
+        bool is_write;
+        uint64_t address;
+        uint32_t size;
+        const uint8_t* write_data;     // Only read while dispatching
+    };
+    struct PipelinedReply;
+    void dispatch_pipelined(Connection& conn, QemuSystemC::MessageType type, ReplyFormat format,
+                            uint64_t transaction_id, std::vector<uint8_t> payload,
+                            const std::vector<PipelinedAccess>& accesses);
+    void connection_writer(Connection& conn);
+    bool write_frames(Connection& conn, const std::vector<uint8_t>& frames);
 
     // Utility methods
-    bool send_message(int socket, QemuSystemC::MessageType type, 
+    bool send_message(Connection& conn, QemuSystemC::MessageType type, 
                      uint64_t transaction_id, const void* data, uint32_t size);
-    bool receive_message(int socket, QemuSystemC::MessageHeader& header, 
-                        std::vector<uint8_t>& data);
+    bool receive_ring_message(Connection& conn, QemuSystemC::MessageHeader& header, const uint8_t*& payload);
+    static bool send_all(int socket, const uint8_t* data, size_t size);
+    std::unique_ptr<QemuSystemC::ShmRegion> create_shm_region(std::string& error);
+    static bool peer_closed(int socket);
 
     // SystemC model interface
-    WhitneySystemCModelEnhanced* memory_model;
+    OpenDDRSystemCModelVerificationDisabled* memory_model;
     
     // Clock and reset signals for the memory model
     sc_clock* model_clock;
@@ -186,7 +269,7 @@ private:
     sc_signal<bool> axi_rvalid;
     sc_signal<bool> axi_rready;
 
-    // Additional signals for enhanced Whitney model
+    // Additional signals for the enhanced model
     sc_clock* slow_clock;
     
     // APB interface signals
@@ -201,22 +284,7 @@ private:
     
     // DFI read data signals (inputs to memory model)
     sc_signal<bool> dfi_rddata_valid;
-    sc_signal<sc_uint<32>> dfi_rddata_0;
-    sc_signal<sc_uint<32>> dfi_rddata_1;
-    sc_signal<sc_uint<32>> dfi_rddata_2;
-    sc_signal<sc_uint<32>> dfi_rddata_3;
-    sc_signal<sc_uint<32>> dfi_rddata_4;
-    sc_signal<sc_uint<32>> dfi_rddata_5;
-    sc_signal<sc_uint<32>> dfi_rddata_6;
-    sc_signal<sc_uint<32>> dfi_rddata_7;
-    sc_signal<sc_uint<32>> dfi_rddata_8;
-    sc_signal<sc_uint<32>> dfi_rddata_9;
-    sc_signal<sc_uint<32>> dfi_rddata_10;
-    sc_signal<sc_uint<32>> dfi_rddata_11;
-    sc_signal<sc_uint<32>> dfi_rddata_12;
-    sc_signal<sc_uint<32>> dfi_rddata_13;
-    sc_signal<sc_uint<32>> dfi_rddata_14;
-    sc_signal<sc_uint<32>> dfi_rddata_15;
+    DFIDataSignal<32> dfi_rddata;
     
     // DFI output signals (outputs from memory model - need dummy connections)
     sc_signal<sc_uint<2>> dfi_dram_clk_disable_0;
@@ -235,58 +303,10 @@ private:
     sc_signal<sc_uint<4>> dfi_wck_en;
     sc_signal<sc_uint<2>> dfi_wck_toggle;
     
-    // DFI write data outputs
-    sc_signal<sc_uint<32>> dfi_wrdata_0;
-    sc_signal<sc_uint<32>> dfi_wrdata_1;
-    sc_signal<sc_uint<32>> dfi_wrdata_2;
-    sc_signal<sc_uint<32>> dfi_wrdata_3;
-    sc_signal<sc_uint<32>> dfi_wrdata_4;
-    sc_signal<sc_uint<32>> dfi_wrdata_5;
-    sc_signal<sc_uint<32>> dfi_wrdata_6;
-    sc_signal<sc_uint<32>> dfi_wrdata_7;
-    sc_signal<sc_uint<32>> dfi_wrdata_8;
-    sc_signal<sc_uint<32>> dfi_wrdata_9;
-    sc_signal<sc_uint<32>> dfi_wrdata_10;
-    sc_signal<sc_uint<32>> dfi_wrdata_11;
-    sc_signal<sc_uint<32>> dfi_wrdata_12;
-    sc_signal<sc_uint<32>> dfi_wrdata_13;
-    sc_signal<sc_uint<32>> dfi_wrdata_14;
-    sc_signal<sc_uint<32>> dfi_wrdata_15;
-    
-    // DFI write data masks and enables
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_15;
-    
-    sc_signal<sc_uint<4>> dfi_wrdata_en_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_15;
+    // DFI write data, masks and enables (all 16 phases)
+    DFIDataSignal<32> dfi_wrdata;
+    DFIDataSignal<4> dfi_wrdata_mask;
+    DFIDataSignal<4> dfi_wrdata_en;
     
     // DFI read control outputs
     sc_signal<bool> mc_rdrst_b;
@@ -296,13 +316,21 @@ private:
     // Server configuration
     int server_port;
     int server_socket;
+    std::string unix_socket_path;   // Empty: TCP only
+    int unix_socket;
     std::atomic<bool> server_running;
     std::atomic<bool> shutdown_requested;
     
-    // Client management
-    std::vector<std::thread> client_threads;
+    // Client management: socket connections live on the reactors; ring
+    // connections each get a service thread, joined once finished
+    struct RingService {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> finished;
+    };
+    int reactor_threads;
+    std::vector<std::unique_ptr<Reactor>> reactors;
+    std::vector<RingService> ring_services;
     std::mutex clients_mutex;
-    std::thread server_thread;  // Dedicated server thread for accepting connections
     
     // Transaction management
     std::atomic<uint64_t> transaction_counter;
@@ -316,6 +344,19 @@ private:
     std::atomic<uint64_t> bytes_read;
     std::atomic<uint64_t> bytes_written;
     std::chrono::high_resolution_clock::time_point start_time;
+    QemuSystemC::LatencyHistogram read_sim_latency;    // ps, timed mode only
+    QemuSystemC::LatencyHistogram write_sim_latency;
+    QemuSystemC::LatencyHistogram read_wall_latency;   // ns
+    QemuSystemC::LatencyHistogram write_wall_latency;
+    
+    // Model counters as of the last publish_model_statistics
+    std::mutex model_stats_mutex;
+    ModelStatistics model_stats;
+    uint64_t model_stats_time_ps;
+    
+    // Optional metrics endpoint (--metrics)
+    std::string metrics_address;
+    std::unique_ptr<QemuSystemC::MetricsEndpoint> metrics;
     
     // Configuration
     uint64_t memory_size;
@@ -324,18 +365,80 @@ private:
     std::string architecture;
     
     // Synchronization and flow control
-    std::mutex memory_mutex;
+    std::mutex memory_mutex;                       // Only guards sleeping on memory_cv
     std::condition_variable memory_cv;
-    std::queue<std::function<void()>> memory_operations;
-    std::atomic<int> active_transaction_count;
-    static constexpr int MAX_PENDING_TRANSACTIONS = 8;  // Limit concurrent transactions
+    std::atomic<bool> simulation_idle;             // Set while wait_for_pending_work sleeps
+    bool wake_requested;                           // Guarded by memory_mutex
+    static constexpr int SHM_POLL_INTERVAL_MS = 100;    // Hang-up checks while a ring is idle
+    static constexpr int SHM_SEND_TIMEOUT_MS = 5000;    // Client not draining its response ring
+    static constexpr size_t RX_BUFFER_SIZE = 64 * 1024; // Initial socket receive buffer per connection
+    static constexpr uint32_t MAX_MESSAGE_LENGTH = 1 << 20;  // Longer payloads mean a broken stream
+    static constexpr int MAX_PIPELINED_ACCESSES = 64;   // Credits per pipelined connection; the reader stalls beyond
+    static constexpr int DEFAULT_REACTOR_THREADS = 2;
+    static constexpr int REACTOR_MAX_EVENTS = 64;       // Per epoll_wait
+    static constexpr int REACTOR_TICK_MS = 500;         // Shutdown checks while idle
+    
+    // Length of one sc_start slice, see set_slice
+    sc_time slice;
+    
+    // One access of the timed path, split into beats.  A client thread
+    // allocates it; the simulation thread gathers the beats' responses and
+    // deletes it after done has run.
+    struct TimedBurst {
+        bool is_write;
+        uint64_t address;
+        uint32_t size;
+        std::vector<uint8_t> data;     // Read data
+        uint32_t remaining;            // Beats still waiting for a response
+        uint32_t status;
+        sc_time start;                 // Earliest beat issue seen so far
+        bool started;
+        std::function<void(uint32_t, uint64_t, const uint8_t*)> done;
+    };
+    
+    // One beat: a client thread queues it on timed_requests,
+    // memory_interface_process issues it on the AXI ports and
+    // timed_response_monitor completes it when its B or R beat arrives
+    struct TimedBeat {
+        TimedBurst* burst;
+        uint64_t address;
+        uint64_t data;                 // Write data
+        uint8_t strb;
+        bool is_write;
+    };
+    
+    // An issued beat awaiting its response
+    struct TimedAccess {
+        TimedBeat beat;
+        sc_time start;
+    };
+    
+    bool timed_mode;
+    uint16_t next_axi_id;                  // Only used by memory_interface_process
+    std::atomic<int> timed_in_flight;      // Keeps the kernel running while > 0
+    static constexpr int TIMED_ACCESS_TIMEOUT_CYCLES = 100000;
+    
+    // Beats queued by client threads for memory_interface_process
+    BridgeRequestChannel<TimedBeat> timed_requests;
+    
+    // Issued accesses awaiting their response, by AXI ID (simulation thread only)
+    std::map<uint16_t, TimedAccess> timed_outstanding;
+    sc_event timed_issued;
     
     // Helper methods
     void connect_memory_model();
     void initialize_signals();
     void perform_axi_write(uint64_t address, uint32_t size, const uint8_t* data);
-    uint64_t perform_axi_read(uint64_t address, uint32_t size);
+    void perform_axi_read(uint64_t address, uint32_t size, uint8_t* data);
     void wait_for_axi_transaction();
+    uint32_t timed_access(bool is_write, uint64_t address, uint32_t size,
+                          const uint8_t* write_data, uint8_t* read_data, uint64_t& latency_ps);
+    void submit_timed_burst(bool is_write, uint64_t address, uint32_t size, const uint8_t* write_data,
+                            std::function<void(uint32_t, uint64_t, const uint8_t*)> done);
+    void enqueue_timed_beat(const TimedBeat& beat);
+    void issue_timed_access(const TimedBeat& beat);
+    void complete_timed_access(uint16_t id, uint32_t status, uint64_t data);
+    void timed_response_monitor();
     
     // Trace file handle
     sc_trace_file* trace_fp;
@@ -343,19 +446,26 @@ private:
 };
 
 // Standalone server class for command-line usage
-class WhitneySystemCServer {
+class OpenDDRSystemCServer {
 public:
-    WhitneySystemCServer(int port, uint64_t memory_size, const std::string& arch);
-    ~WhitneySystemCServer();
+    OpenDDRSystemCServer(int port, uint64_t memory_size, const std::string& arch);
+    ~OpenDDRSystemCServer();
     
     void run();
     void stop();
     void setup_tracing(const std::string& trace_filename);
+    void set_slice(const sc_time& slice);
+    void set_timed(bool timed);
+    void set_unix_socket(const std::string& path);
+    void set_reactor_threads(int count);
+    void set_heartbeat(std::chrono::milliseconds interval);  // 0: idle simulation sleeps
+    void set_metrics_address(const std::string& address);
     
 private:
     std::unique_ptr<QemuSystemCBridge> bridge;
     std::thread systemc_thread;
     std::atomic<bool> running;
+    std::chrono::milliseconds heartbeat;
     
     void systemc_simulation_thread();
 };
@@ -0,0 +1,107 @@
+#ifndef QEMU_SYSTEMC_HISTOGRAM_H
+#define QEMU_SYSTEMC_HISTOGRAM_H
+
+// Lock-free latency histogram for the bridge's status reports.
+//
+// Buckets are log-linear: values below 16 have a bucket each, and every
+// power of two above is split into 16 equal buckets, so a percentile is
+// within 1/16 of the true value over the whole 64-bit range.  Any thread
+// may record; a record is three relaxed atomic adds.  Readers see a
+// consistent-enough picture for monitoring, not an exact snapshot.
+//
+// Header only and free of SystemC.
+
+#include <atomic>
+#include <cstdint>
+
+namespace QemuSystemC {
+
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BITS = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int BUCKETS = SUB_BUCKETS + (64 - SUB_BITS) * SUB_BUCKETS;
+
+    LatencyHistogram() : total_count(0), total_sum(0), largest(0) {
+        for (auto& bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    // Any thread
+    void record(uint64_t value) {
+        buckets[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        total_count.fetch_add(1, std::memory_order_relaxed);
+        total_sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t seen = largest.load(std::memory_order_relaxed);
+        while (value > seen && !largest.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t count() const { return total_count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return total_sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return largest.load(std::memory_order_relaxed); }
+
+    // Upper bound of the bucket holding the q-quantile (0 < q <= 1), capped
+    // at the largest value recorded; 0 while empty
+    uint64_t percentile(double q) const {
+        uint64_t n = count();
+        if (n == 0) {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(q * n);
+        if (rank < 1) {
+            rank = 1;
+        }
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            seen += buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                uint64_t bound = upper_bound(i);
+                return bound < max() ? bound : max();
+            }
+        }
+        return max();
+    }
+
+    // Values recorded that are <= limit, rounded to whole buckets
+    uint64_t count_at_most(uint64_t limit) const {
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS && upper_bound(i) <= limit; i++) {
+            seen += buckets[i].load(std::memory_order_relaxed);
+        }
+        return seen;
+    }
+
+private:
+    static int bucket_of(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<int>(value);
+        }
+        int exponent = 63 - __builtin_clzll(value);
+        int mantissa = static_cast<int>(value >> (exponent - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return SUB_BUCKETS + (exponent - SUB_BITS) * SUB_BUCKETS + mantissa;
+    }
+
+    // Largest value that lands in bucket i
+    static uint64_t upper_bound(int i) {
+        if (i < SUB_BUCKETS) {
+            return static_cast<uint64_t>(i);
+        }
+        int exponent = (i - SUB_BUCKETS) / SUB_BUCKETS + SUB_BITS;
+        uint64_t mantissa = static_cast<uint64_t>((i - SUB_BUCKETS) % SUB_BUCKETS);
+        uint64_t low = (SUB_BUCKETS + mantissa) << (exponent - SUB_BITS);
+        return low + ((1ULL << (exponent - SUB_BITS)) - 1);
+    }
+
+    std::atomic<uint64_t> buckets[BUCKETS];
+    std::atomic<uint64_t> total_count;
+    std::atomic<uint64_t> total_sum;
+    std::atomic<uint64_t> largest;
+};
+
+} // namespace QemuSystemC
+
+#endif // QEMU_SYSTEMC_HISTOGRAM_H
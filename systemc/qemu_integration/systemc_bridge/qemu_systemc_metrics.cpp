@@ -0,0 +1,201 @@
+#include "qemu_systemc_metrics.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace QemuSystemC {
+
+MetricsEndpoint::MetricsEndpoint(std::function<std::string()> render)
+    : render(std::move(render))
+    , listener(-1)
+    , running(false) {
+}
+
+MetricsEndpoint::~MetricsEndpoint() {
+    stop();
+}
+
+void MetricsEndpoint::start(const std::string& address) {
+    char* end;
+    unsigned long port = strtoul(address.c_str(), &end, 10);
+    bool is_port = !address.empty() && *end == '\0';
+
+    if (is_port) {
+        if (port == 0 || port > 65535) {
+            throw std::runtime_error("Invalid metrics port: " + address);
+        }
+        listener = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listener < 0) {
+            throw std::runtime_error("Failed to create metrics socket");
+        }
+        int opt = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+        // Local scrapers only
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(static_cast<uint16_t>(port));
+        if (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(listener, 16) < 0) {
+            close(listener);
+            listener = -1;
+            throw std::runtime_error("Failed to listen for metrics on 127.0.0.1:" + address + ": " + strerror(errno));
+        }
+    } else {
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (address.size() >= sizeof(addr.sun_path)) {
+            throw std::runtime_error("Metrics socket path too long: " + address);
+        }
+        strncpy(addr.sun_path, address.c_str(), sizeof(addr.sun_path) - 1);
+
+        listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listener < 0) {
+            throw std::runtime_error("Failed to create metrics socket");
+        }
+        unlink(address.c_str());  // Left behind by a previous run
+        if (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(listener, 16) < 0) {
+            close(listener);
+            listener = -1;
+            throw std::runtime_error("Failed to listen for metrics on " + address + ": " + strerror(errno));
+        }
+        unix_path = address;
+    }
+
+    running.store(true);
+    thread = std::thread(&MetricsEndpoint::serve, this);
+}
+
+void MetricsEndpoint::stop() {
+    if (!running.exchange(false)) {
+        return;
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+    close(listener);
+    listener = -1;
+    if (!unix_path.empty()) {
+        unlink(unix_path.c_str());
+        unix_path.clear();
+    }
+}
+
+void MetricsEndpoint::serve() {
+    while (running.load()) {
+        struct pollfd pfd = {listener, POLLIN, 0};
+        if (poll(&pfd, 1, POLL_TICK_MS) <= 0) {
+            continue;
+        }
+        int client = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) {
+            continue;
+        }
+        struct timeval timeout = {CLIENT_TIMEOUT_MS / 1000, (CLIENT_TIMEOUT_MS % 1000) * 1000};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        answer(client);
+        close(client);
+    }
+}
+
+// Reads the request head and answers it; the connection is closed after
+void MetricsEndpoint::answer(int client) {
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE) {
+        ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            return;
+        }
+        request.append(buffer, n);
+    }
+
+    bool found = request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 13, "GET /metrics?") == 0 ||
+                 request.compare(0, 6, "GET / ") == 0;
+    std::string body = found ? render() : "Not found; try /metrics\n";
+    std::string response = found ? "HTTP/1.0 200 OK\r\n"
+                                   "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                 : "HTTP/1.0 404 Not Found\r\n"
+                                   "Content-Type: text/plain; charset=utf-8\r\n";
+    response += "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                "Connection: close\r\n\r\n";
+    response += body;
+
+    size_t sent = 0;
+    while (sent < response.size()) {
+        ssize_t n = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return;
+        }
+        sent += n;
+    }
+}
+
+void append_family(std::string& out, const char* name, const char* type, const char* help) {
+    out += "# HELP ";
+    out += name;
+    out += ' ';
+    out += help;
+    out += "\n# TYPE ";
+    out += name;
+    out += ' ';
+    out += type;
+    out += '\n';
+}
+
+static void append_name(std::string& out, const char* name, const std::string& labels) {
+    out += name;
+    if (!labels.empty()) {
+        out += '{';
+        out += labels;
+        out += '}';
+    }
+    out += ' ';
+}
+
+void append_sample(std::string& out, const char* name, const std::string& labels, double value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.9g", value);
+    append_name(out, name, labels);
+    out += text;
+    out += '\n';
+}
+
+void append_sample(std::string& out, const char* name, const std::string& labels, uint64_t value) {
+    append_name(out, name, labels);
+    out += std::to_string(value);
+    out += '\n';
+}
+
+void append_histogram(std::string& out, const char* name, const std::string& labels,
+                      const LatencyHistogram& histogram, double unit_seconds, const std::vector<double>& bounds) {
+    const std::string bucket = std::string(name) + "_bucket";
+    const std::string prefix = labels.empty() ? "" : labels + ",";
+
+    // count() first, so no bucket exceeds the +Inf bucket if samples arrive
+    // while this runs
+    uint64_t count = histogram.count();
+    for (double bound : bounds) {
+        char le[32];
+        snprintf(le, sizeof(le), "%g", bound);
+        uint64_t at_most = histogram.count_at_most(static_cast<uint64_t>(bound / unit_seconds + 0.5));
+        append_sample(out, bucket.c_str(), prefix + "le=\"" + le + "\"", at_most < count ? at_most : count);
+    }
+    append_sample(out, bucket.c_str(), prefix + "le=\"+Inf\"", count);
+    append_sample(out, (std::string(name) + "_sum").c_str(), labels, histogram.sum() * unit_seconds);
+    append_sample(out, (std::string(name) + "_count").c_str(), labels, count);
+}
+
+} // namespace QemuSystemC
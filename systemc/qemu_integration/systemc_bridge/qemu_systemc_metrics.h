@@ -0,0 +1,68 @@
+#ifndef QEMU_SYSTEMC_METRICS_H
+#define QEMU_SYSTEMC_METRICS_H
+
+// Metrics endpoint of the bridge server in the Prometheus text exposition
+// format (version 0.0.4).
+//
+// MetricsEndpoint is a small HTTP/1.0 server on its own thread, bound to
+// 127.0.0.1 or to an AF_UNIX socket.  Each scrape calls the render function
+// on that thread, so rendering must only read state that other threads
+// publish (atomics, or copies taken under a short lock).  One request per
+// connection; anything but GET /metrics (or GET /) gets a 404.
+//
+// The append_* helpers format metric families for the render function.
+//
+// This header does not depend on SystemC.
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "qemu_systemc_histogram.h"
+
+namespace QemuSystemC {
+
+class MetricsEndpoint {
+public:
+    explicit MetricsEndpoint(std::function<std::string()> render);
+    ~MetricsEndpoint();
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    // address is a TCP port on 127.0.0.1 or an AF_UNIX socket path.
+    // Throws std::runtime_error if it cannot listen.
+    void start(const std::string& address);
+    void stop();
+
+private:
+    static constexpr int POLL_TICK_MS = 500;          // Shutdown checks while idle
+    static constexpr int CLIENT_TIMEOUT_MS = 1000;    // Slow scrapers are dropped
+    static constexpr size_t MAX_REQUEST_SIZE = 8192;
+
+    void serve();
+    void answer(int client);
+
+    std::function<std::string()> render;
+    std::string unix_path;
+    int listener;
+    std::atomic<bool> running;
+    std::thread thread;
+};
+
+// "# HELP" and "# TYPE" lines of a metric family
+void append_family(std::string& out, const char* name, const char* type, const char* help);
+
+// One sample; labels is empty or a list like op="read"
+void append_sample(std::string& out, const char* name, const std::string& labels, double value);
+void append_sample(std::string& out, const char* name, const std::string& labels, uint64_t value);
+
+// The _bucket, _sum and _count series of one histogram.  Values in
+// histogram are in units of unit_seconds; bounds are in seconds.
+void append_histogram(std::string& out, const char* name, const std::string& labels,
+                      const LatencyHistogram& histogram, double unit_seconds, const std::vector<double>& bounds);
+
+} // namespace QemuSystemC
+
+#endif // QEMU_SYSTEMC_METRICS_H
@@ -0,0 +1,226 @@
+#ifndef QEMU_SYSTEMC_PROTOCOL_H
+#define QEMU_SYSTEMC_PROTOCOL_H
+
+// Wire protocol between QEMU (or test_client) and the SystemC bridge server.
+//
+// Every message is a MessageHeader followed by header.length bytes of
+// payload.  All structures are packed and sent in host byte order.  This
+// header does not depend on SystemC, so clients include it directly.
+
+#include <cstdint>
+
+namespace QemuSystemC {
+
+// Message types
+enum MessageType {
+    MSG_READ_REQUEST = 1,
+    MSG_READ_RESPONSE = 2,
+    MSG_WRITE_REQUEST = 3,
+    MSG_WRITE_RESPONSE = 4,
+    MSG_INIT_REQUEST = 5,
+    MSG_INIT_RESPONSE = 6,
+    MSG_STATUS_REQUEST = 7,
+    MSG_STATUS_RESPONSE = 8,
+    MSG_SHUTDOWN = 9,
+    MSG_MEMFD_ATTACH = 10,         // AF_UNIX only: guest RAM memfd in SCM_RIGHTS
+    MSG_MEMFD_ATTACH_RESPONSE = 11,
+    MSG_BATCH_REQUEST = 12,        // BatchHeader + BatchRequestRecord[count]
+    MSG_BATCH_RESPONSE = 13,       // BatchHeader + BatchResponseRecord[count]
+    MSG_EXT_STATUS_REQUEST = 14,
+    MSG_EXT_STATUS_RESPONSE = 15   // ExtStatusResponse
+};
+
+// Message header.  A response carries its request's transaction_id; with
+// TRANSPORT_PIPELINED that is the only way to match them, since responses
+// leave in completion order.
+struct MessageHeader {
+    uint32_t type;
+    uint32_t length;
+    uint64_t transaction_id;
+    uint64_t timestamp;
+} __attribute__((packed));
+
+// Memory access request in its original fixed-size form.  Requests are read
+// as an AccessRequest followed by the data, so this is still accepted; a
+// response has this layout unless TRANSPORT_VARIABLE_PAYLOAD was negotiated.
+struct MemoryRequest {
+    uint64_t address;
+    uint32_t size;
+    uint32_t access_type;  // 0=read, 1=write
+    uint8_t data[64];      // Maximum data size
+} __attribute__((packed));
+
+// Memory access response
+struct MemoryResponse {
+    uint64_t address;
+    uint32_t size;
+    uint32_t status;       // 0=success, 1=error
+    uint8_t data[64];      // Response data
+    uint64_t latency_ps;   // Simulated request-to-response time; 0 when the server is not --timed
+} __attribute__((packed));
+
+// Transports a client can ask for in InitRequest.transport_flags; the
+// server answers with the subset it switched to
+enum TransportFlags : uint32_t {
+    TRANSPORT_SHM_RING = 1 << 0,   // Shared-memory rings, see qemu_systemc_shm.h
+    TRANSPORT_PIPELINED = 1 << 1,  // Many requests in flight, responses in completion order
+    TRANSPORT_VARIABLE_PAYLOAD = 1 << 2  // AccessResponse instead of MemoryResponse
+};
+
+// Variable-length accesses.  The data follows the fixed part and the
+// MessageHeader length gives the total, so an 8-byte read costs 16 bytes of
+// request and 24 + 8 of response.  Accesses of up to MAX_ACCESS_SIZE bytes
+// at any alignment are split into AXI beats by the server.
+static constexpr uint32_t MAX_ACCESS_SIZE = 4096;
+
+// Read or write request: MSG_READ_REQUEST or MSG_WRITE_REQUEST, followed by
+// size bytes of write data (none for reads, and none needed for writes
+// inside attached guest RAM)
+struct AccessRequest {
+    uint64_t address;
+    uint32_t size;             // 1..MAX_ACCESS_SIZE
+    uint32_t access_type;      // 0=read, 1=write
+} __attribute__((packed));
+
+// Response with TRANSPORT_VARIABLE_PAYLOAD, followed by size bytes of read
+// data (none for writes or failed reads)
+struct AccessResponse {
+    uint64_t address;
+    uint32_t size;
+    uint32_t status;           // 0=success, 1=error
+    uint64_t latency_ps;
+} __attribute__((packed));
+
+// System initialization request.  Older clients send it without the
+// trailing fields; the server reads those as zero.
+struct InitRequest {
+    uint64_t memory_size;
+    uint32_t page_size;
+    uint32_t cache_line_size;
+    char arch_name[32];
+    uint32_t transport_flags;  // TransportFlags requested
+    uint32_t reserved;
+} __attribute__((packed));
+
+// Flow control.  InitResponse.credits is how many accesses the client may
+// have unanswered: a read or write request spends one credit, a batch one
+// per record, and each response returns what its request spent.  Other
+// messages are free, and a message may always be sent while nothing is
+// outstanding, whatever its size.  A client out of credits waits for a
+// response (or queues locally) instead of sleeping for a guessed time.  The
+// server stops reading a connection at its grant, so overspending stalls
+// the client rather than overflowing the model's queues.
+//
+// System initialization response, always sent on the socket.  Older
+// servers leave out credits; read them as 0, which means one at a time.
+struct InitResponse {
+    uint32_t status;           // 0=success
+    uint32_t transport_flags;  // TransportFlags in use from the next message on
+    char shm_name[64];         // TRANSPORT_SHM_RING: region to attach
+    uint32_t credits;          // Accesses allowed in flight, see above
+    uint32_t reserved;
+} __attribute__((packed));
+
+// Guest RAM hand-off.  The memfd travels as SCM_RIGHTS ancillary data with
+// this message; the server maps it shared.  Inside [guest_base, guest_base +
+// size) the mapping is the functional data: writes take their data from it
+// and reads return it, so requests there only need address and size.
+struct MemfdAttachRequest {
+    uint64_t guest_base;       // Guest physical address of the first byte
+    uint64_t size;
+} __attribute__((packed));
+
+// Batched accesses.  One frame carries up to MAX_BATCH_RECORDS single-beat
+// accesses and is answered by one frame with a record per access, in the
+// same order.  Records are matched by their own transaction_id; the frame's
+// header transaction_id only names the batch.  A failed record does not
+// stop the rest of the batch.
+static constexpr uint32_t MAX_BATCH_RECORDS = 64;
+
+struct BatchHeader {
+    uint32_t count;
+    uint32_t reserved;
+} __attribute__((packed));
+
+struct BatchRequestRecord {
+    uint64_t transaction_id;
+    uint64_t address;
+    uint32_t size;             // 1..8
+    uint32_t access_type;      // 0=read, 1=write
+    uint8_t data[8];           // Write data
+} __attribute__((packed));
+
+struct BatchResponseRecord {
+    uint64_t transaction_id;
+    uint32_t status;           // 0=success, 1=error
+    uint32_t size;
+    uint64_t latency_ps;
+    uint8_t data[8];           // Read data
+} __attribute__((packed));
+
+// System status response
+struct StatusResponse {
+    uint64_t total_reads;
+    uint64_t total_writes;
+    uint64_t total_errors;
+    uint64_t current_bandwidth;
+    uint32_t active_banks;
+    uint32_t page_hits;
+    uint32_t page_misses;
+    uint32_t reserved;
+} __attribute__((packed));
+
+// Distribution of one kind of latency.  Percentiles are accurate to 1/16 of
+// their value; all are 0 until the first sample.
+struct LatencySummary {
+    uint64_t count;
+    uint64_t p50;
+    uint64_t p99;
+    uint64_t p999;
+    uint64_t max;
+} __attribute__((packed));
+
+static constexpr uint32_t STATUS_BANKS = 16;
+
+// Extended status: the bridge's counters, the model's live statistics and
+// latency percentiles since the server started.  Model counters are as of
+// the end of the last simulation slice.  Simulated latencies (ps) are only
+// collected with --timed; wall latencies (ns) run from the bridge taking an
+// access to its result being ready.
+struct ExtStatusResponse {
+    uint64_t total_reads;
+    uint64_t total_writes;
+    uint64_t total_errors;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    uint64_t uptime_ns;
+    uint64_t read_bandwidth;       // Bytes per second since start
+    uint64_t write_bandwidth;
+    uint64_t sim_time_ps;          // Simulated time of the model counters
+    
+    uint64_t model_reads;          // AXI transactions the model accepted
+    uint64_t model_writes;
+    uint64_t ddr_commands;
+    uint64_t page_hits;
+    uint64_t page_misses;
+    uint64_t page_conflicts;       // Misses with another row open in the bank
+    uint64_t open_banks;
+    uint64_t bank_accesses[STATUS_BANKS];  // Column accesses per bank
+    
+    // Queue high-water marks
+    uint32_t write_addr_queue_hwm;
+    uint32_t write_data_queue_hwm;
+    uint32_t write_resp_queue_hwm;
+    uint32_t read_addr_queue_hwm;
+    uint32_t read_resp_queue_hwm;
+    uint32_t ddr_cmd_queue_hwm;
+    
+    LatencySummary read_sim_ps;
+    LatencySummary write_sim_ps;
+    LatencySummary read_wall_ns;
+    LatencySummary write_wall_ns;
+} __attribute__((packed));
+
+} // namespace QemuSystemC
+
+#endif // QEMU_SYSTEMC_PROTOCOL_H
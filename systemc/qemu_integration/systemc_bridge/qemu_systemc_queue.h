@@ -0,0 +1,144 @@
+#ifndef QEMU_SYSTEMC_QUEUE_H
+#define QEMU_SYSTEMC_QUEUE_H
+
+// Lock-free multi-producer/single-consumer queues.
+//
+// MpscQueue is unbounded: any number of threads may push; one thread pops.
+// A push is one atomic exchange and a store, so socket threads never wait on
+// each other or on the consumer.  Nodes form a singly linked list behind a dummy node; popping
+// moves the value out of the dummy's successor, which becomes the new dummy.
+//
+// A push that has swapped the head but not linked its node yet is invisible
+// to pop() until it finishes, so an empty result only means "nothing
+// complete yet".  Producers that need to wake a sleeping consumer must
+// therefore signal after push() returns.
+//
+// BoundedMpscQueue is a ring of preallocated cells, each with a sequence
+// number that tells producers and the consumer whose turn it is, so a push
+// allocates nothing.  Producers claim a cell with one compare-and-swap;
+// a full ring makes try_push fail instead of growing.
+//
+// Header only and free of SystemC.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace QemuSystemC {
+
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head(new Node()), tail(head.load(std::memory_order_relaxed)) {}
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue() {
+        while (tail != nullptr) {
+            Node* next = tail->next.load(std::memory_order_relaxed);
+            delete tail;
+            tail = next;
+        }
+    }
+
+    // Any thread
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer thread only
+    bool pop(T& value) {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        value = std::move(next->value);
+        delete tail;
+        tail = next;
+        return true;
+    }
+
+    // Consumer thread only
+    bool empty() const { return tail->next.load(std::memory_order_acquire) == nullptr; }
+
+private:
+    struct Node {
+        Node() : next(nullptr) {}
+        explicit Node(T v) : next(nullptr), value(std::move(v)) {}
+        std::atomic<Node*> next;
+        T value;
+    };
+
+    alignas(64) std::atomic<Node*> head;   // Producers: last node pushed
+    alignas(64) Node* tail;                // Consumer: dummy before the next value
+};
+
+template <typename T, size_t Capacity>
+class BoundedMpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    BoundedMpscQueue() : cells(new Cell[Capacity]), enqueue_pos(0), dequeue_pos(0) {
+        for (size_t i = 0; i < Capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    // Any thread.  False if the ring is full.
+    bool try_push(const T& value) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & (Capacity - 1)];
+            intptr_t diff = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) -
+                            static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer thread only
+    bool pop(T& value) {
+        Cell& cell = cells[dequeue_pos & (Capacity - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(dequeue_pos + Capacity, std::memory_order_release);
+        dequeue_pos++;
+        return true;
+    }
+
+    // Consumer thread only
+    bool empty() const {
+        return cells[dequeue_pos & (Capacity - 1)].sequence.load(std::memory_order_acquire) != dequeue_pos + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<size_t> enqueue_pos;   // Producers: next cell to claim
+    alignas(64) size_t dequeue_pos;                // Consumer: next cell to read
+};
+
+} // namespace QemuSystemC
+
+#endif // QEMU_SYSTEMC_QUEUE_H
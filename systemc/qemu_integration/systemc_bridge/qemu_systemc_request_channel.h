@@ -0,0 +1,52 @@
+#ifndef QEMU_SYSTEMC_REQUEST_CHANNEL_H
+#define QEMU_SYSTEMC_REQUEST_CHANNEL_H
+
+// Hand-off of bridge requests from socket threads into the SystemC kernel.
+//
+// A socket thread pushes a fixed-size record into a preallocated lock-free
+// ring and calls async_request_update(), the one kernel entry point that
+// other OS threads may use.  The kernel then runs update() in its next
+// update phase, which notifies arrived_event(), so the consuming process
+// wakes within a delta cycle instead of polling the ring once per slice.
+//
+// Records are copied by value and must be trivially copyable; pushing
+// allocates nothing.  pop() and empty() belong to the simulation thread.
+
+#include <systemc.h>
+#include <thread>
+#include <type_traits>
+
+#include "qemu_systemc_queue.h"
+
+template <typename Record, size_t Capacity = 16384>
+class BridgeRequestChannel : public sc_prim_channel {
+    static_assert(std::is_trivially_copyable<Record>::value, "records are copied between threads");
+
+public:
+    explicit BridgeRequestChannel(const char* name) : sc_prim_channel(name) {}
+
+    // Any thread.  A full ring means the simulation is that far behind, so
+    // the producer yields until a slot frees up.
+    void push(const Record& record) {
+        while (!records.try_push(record)) {
+            async_request_update();
+            std::this_thread::yield();
+        }
+        async_request_update();
+    }
+
+    // Simulation thread only
+    bool pop(Record& record) { return records.pop(record); }
+    bool empty() const { return records.empty(); }
+
+    const sc_event& arrived_event() const { return arrived; }
+
+protected:
+    void update() override { arrived.notify(SC_ZERO_TIME); }
+
+private:
+    QemuSystemC::BoundedMpscQueue<Record, Capacity> records;
+    sc_event arrived;
+};
+
+#endif // QEMU_SYSTEMC_REQUEST_CHANNEL_H
@@ -0,0 +1,328 @@
+#ifndef QEMU_SYSTEMC_SHM_H
+#define QEMU_SYSTEMC_SHM_H
+
+// Shared-memory ring transport for the QEMU-SystemC protocol.
+//
+// A client that sets TRANSPORT_SHM_RING in its InitRequest gets a POSIX
+// shared-memory region from the server (named in the InitResponse) and from
+// then on exchanges messages through it instead of the socket.  The region
+// holds two single-producer/single-consumer rings of fixed-size slots, one
+// for requests and one for responses; a slot is a MessageHeader followed by
+// its payload.  The socket stays open only to notice the peer going away.
+//
+// A side waiting on an empty (or full) ring first spins, then sleeps on a
+// futex "doorbell" word that the other side only bumps and wakes while a
+// waiter is flagged, so a busy ring costs no system calls at all.  The spin
+// budget adapts: it grows while spinning pays off and shrinks while it does
+// not.
+//
+// Header only and free of SystemC, so clients include it directly.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "qemu_systemc_protocol.h"
+
+namespace QemuSystemC {
+
+static constexpr char SHM_MAGIC[8] = "ODDRSHM";
+static constexpr uint32_t SHM_VERSION = 1;
+static constexpr uint32_t SHM_DEFAULT_SLOTS = 256;     // Per ring, a power of two
+// MessageHeader + payload; large enough for a full batch response and for
+// the largest access with its data
+static constexpr uint32_t SHM_SLOT_SIZE =
+    (sizeof(MessageHeader) +
+     std::max(sizeof(BatchHeader) + MAX_BATCH_RECORDS * sizeof(BatchResponseRecord),
+              sizeof(AccessResponse) + MAX_ACCESS_SIZE) + 63) & ~63u;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "ring indices must be lock-free in shared memory");
+
+// Control words of one ring; indices run freely and are masked on use
+struct ShmRingControl {
+    alignas(64) std::atomic<uint32_t> head;              // Consumer: next slot to read
+    alignas(64) std::atomic<uint32_t> tail;              // Producer: next slot to write
+    alignas(64) std::atomic<uint32_t> data_bell;         // Futex word the consumer sleeps on
+    std::atomic<uint32_t> consumer_waiting;
+    alignas(64) std::atomic<uint32_t> space_bell;        // Futex word the producer sleeps on
+    std::atomic<uint32_t> producer_waiting;
+};
+
+enum ShmRingId {
+    SHM_RING_REQUEST = 0,      // Client -> server
+    SHM_RING_RESPONSE = 1      // Server -> client
+};
+
+struct ShmRegionHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t slot_size;
+    uint32_t reserved;
+    ShmRingControl rings[2];
+};
+
+inline void shm_cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// The region is shared between processes, so no FUTEX_PRIVATE_FLAG
+inline void shm_futex_wait(std::atomic<uint32_t>& word, uint32_t expected, const timespec* timeout) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+}
+
+inline void shm_futex_wake(std::atomic<uint32_t>& word) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+// One side's view of a ring.  Only one thread may push and one thread pop.
+class ShmQueue {
+public:
+    ShmQueue(ShmRingControl& control, uint8_t* slots, uint32_t slot_count, uint32_t slot_size)
+        : ctl(control), slots(slots), mask(slot_count - 1), slot_size(slot_size) {}
+
+    uint32_t max_payload() const { return slot_size - sizeof(MessageHeader); }
+
+    // False if the payload does not fit a slot or the ring stayed full
+    bool push(const MessageHeader& header, const void* data, uint32_t size, int timeout_ms) {
+        if (size > max_payload()) {
+            return false;
+        }
+        uint32_t tail = ctl.tail.load(std::memory_order_relaxed);
+        auto has_space = [&]() { return tail - ctl.head.load(std::memory_order_acquire) <= mask; };
+        if (!has_space() && !wait(ctl.space_bell, ctl.producer_waiting, has_space, timeout_ms)) {
+            return false;
+        }
+
+        uint8_t* slot = slots + static_cast<size_t>(tail & mask) * slot_size;
+        MessageHeader out = header;
+        out.length = size;
+        memcpy(slot, &out, sizeof(out));
+        if (size > 0) {
+            memcpy(slot + sizeof(out), data, size);
+        }
+        ctl.tail.store(tail + 1, std::memory_order_release);
+        ring(ctl.data_bell, ctl.consumer_waiting);
+        return true;
+    }
+
+    // False if nothing arrived within timeout_ms
+    bool pop(MessageHeader& header, std::vector<uint8_t>& data, int timeout_ms) {
+        const uint8_t* payload;
+        if (!peek(header, payload, timeout_ms)) {
+            return false;
+        }
+        data.assign(payload, payload + header.length);
+        consume();
+        return true;
+    }
+
+    // pop() without the copy: payload points into the slot, which stays
+    // the consumer's until consume().  header.length is clamped to the slot.
+    bool peek(MessageHeader& header, const uint8_t*& payload, int timeout_ms) {
+        uint32_t head = ctl.head.load(std::memory_order_relaxed);
+        auto has_data = [&]() { return ctl.tail.load(std::memory_order_acquire) != head; };
+        if (!has_data() && !wait(ctl.data_bell, ctl.consumer_waiting, has_data, timeout_ms)) {
+            return false;
+        }
+
+        const uint8_t* slot = slots + static_cast<size_t>(head & mask) * slot_size;
+        memcpy(&header, slot, sizeof(header));
+        header.length = std::min(header.length, max_payload());
+        payload = slot + sizeof(header);
+        return true;
+    }
+
+    void consume() {
+        uint32_t head = ctl.head.load(std::memory_order_relaxed);
+        ctl.head.store(head + 1, std::memory_order_release);
+        ring(ctl.space_bell, ctl.producer_waiting);
+    }
+
+private:
+    static constexpr uint32_t SPIN_MIN = 64;
+    static constexpr uint32_t SPIN_MAX = 16384;
+
+    ShmRingControl& ctl;
+    uint8_t* slots;
+    uint32_t mask;
+    uint32_t slot_size;
+    uint32_t spin_limit = 1024;
+
+    // Wakes the other side, but only if it has gone to sleep
+    static void ring(std::atomic<uint32_t>& bell, std::atomic<uint32_t>& waiting) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed)) {
+            bell.fetch_add(1, std::memory_order_release);
+            shm_futex_wake(bell);
+        }
+    }
+
+    template <typename Ready>
+    bool wait(std::atomic<uint32_t>& bell, std::atomic<uint32_t>& waiting, Ready ready, int timeout_ms) {
+        for (uint32_t i = 0; i < spin_limit; i++) {
+            shm_cpu_relax();
+            if (ready()) {
+                spin_limit = std::min(spin_limit * 2, SPIN_MAX);
+                return true;
+            }
+        }
+        spin_limit = std::max(spin_limit / 2, SPIN_MIN);
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!ready()) {
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                return false;
+            }
+            // Flag ourselves before the final check; a wake between the two
+            // changes the bell, so FUTEX_WAIT returns at once
+            uint32_t seq = bell.load(std::memory_order_acquire);
+            waiting.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!ready()) {
+                auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+                timespec ts = {static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000)};
+                shm_futex_wait(bell, seq, &ts);
+            }
+            waiting.store(0, std::memory_order_relaxed);
+        }
+        return true;
+    }
+};
+
+// A mapped region: the server creates it, the client attaches by name
+class ShmRegion {
+public:
+    ShmRegion() = default;
+    ShmRegion(const ShmRegion&) = delete;
+    ShmRegion& operator=(const ShmRegion&) = delete;
+
+    ~ShmRegion() {
+        if (base != nullptr) {
+            munmap(base, length);
+        }
+        if (owner) {
+            shm_unlink(shm_name.c_str());
+        }
+    }
+
+    bool create(const std::string& name, uint32_t slot_count, std::string& error) {
+        if (slot_count == 0 || (slot_count & (slot_count - 1)) != 0) {
+            error = "slot count must be a power of two";
+            return false;
+        }
+        int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) {
+            error = "cannot create " + name + ": " + strerror(errno);
+            return false;
+        }
+        shm_name = name;
+        owner = true;
+        size_t size = region_size(slot_count, SHM_SLOT_SIZE);
+        if (ftruncate(fd, size) != 0) {
+            error = "cannot size " + name + ": " + strerror(errno);
+            close(fd);
+            return false;
+        }
+        if (!map(fd, size, error)) {
+            return false;
+        }
+
+        // A fresh mapping is zero-filled, so the control words start at 0
+        ShmRegionHeader* header = static_cast<ShmRegionHeader*>(base);
+        header->version = SHM_VERSION;
+        header->slot_count = slot_count;
+        header->slot_size = SHM_SLOT_SIZE;
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(header->magic, SHM_MAGIC, sizeof(header->magic));
+        return setup_queues(error);
+    }
+
+    bool attach(const std::string& name, std::string& error) {
+        int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            error = "cannot open " + name + ": " + strerror(errno);
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShmRegionHeader)) {
+            error = name + " is not a bridge ring region";
+            close(fd);
+            return false;
+        }
+        shm_name = name;
+        return map(fd, st.st_size, error) && setup_queues(error);
+    }
+
+    const std::string& name() const { return shm_name; }
+    uint32_t slot_count() const { return static_cast<const ShmRegionHeader*>(base)->slot_count; }
+    ShmQueue& requests() { return *queues[SHM_RING_REQUEST]; }
+    ShmQueue& responses() { return *queues[SHM_RING_RESPONSE]; }
+
+private:
+    void* base = nullptr;
+    size_t length = 0;
+    std::string shm_name;
+    bool owner = false;
+    std::unique_ptr<ShmQueue> queues[2];
+
+    static size_t slots_offset() {
+        return (sizeof(ShmRegionHeader) + 63) & ~static_cast<size_t>(63);
+    }
+
+    static size_t region_size(uint32_t slot_count, uint32_t slot_size) {
+        return slots_offset() + 2 * static_cast<size_t>(slot_count) * slot_size;
+    }
+
+    bool map(int fd, size_t size, std::string& error) {
+        void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            error = "cannot map " + shm_name + ": " + strerror(errno);
+            return false;
+        }
+        base = mapped;
+        length = size;
+        return true;
+    }
+
+    bool setup_queues(std::string& error) {
+        ShmRegionHeader* header = static_cast<ShmRegionHeader*>(base);
+        uint32_t count = header->slot_count;
+        if (memcmp(header->magic, SHM_MAGIC, sizeof(header->magic)) != 0 || header->version != SHM_VERSION ||
+            count == 0 || (count & (count - 1)) != 0 || header->slot_size <= sizeof(MessageHeader) ||
+            region_size(count, header->slot_size) > length) {
+            error = shm_name + " is not a bridge ring region";
+            return false;
+        }
+        uint8_t* slots = static_cast<uint8_t*>(base) + slots_offset();
+        size_t ring_bytes = static_cast<size_t>(count) * header->slot_size;
+        for (int r = 0; r < 2; r++) {
+            queues[r].reset(new ShmQueue(header->rings[r], slots + r * ring_bytes, count, header->slot_size));
+        }
+        return true;
+    }
+};
+
+} // namespace QemuSystemC
+
+#endif // QEMU_SYSTEMC_SHM_H
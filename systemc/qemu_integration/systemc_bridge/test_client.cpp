@@ -5,67 +5,20 @@
 #include <chrono>
 #include <random>
 #include <vector>
+#include <map>
 #include <string>
 #include <cstring>
-#include <thread>
 #include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <sys/un.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <unistd.h>
-
-// Protocol definitions (copied from qemu_systemc_bridge.h to avoid SystemC dependency)
-namespace QemuSystemC {
-    enum MessageType {
-        MSG_READ_REQUEST = 1,
-        MSG_READ_RESPONSE = 2,
-        MSG_WRITE_REQUEST = 3,
-        MSG_WRITE_RESPONSE = 4,
-        MSG_INIT_REQUEST = 5,
-        MSG_INIT_RESPONSE = 6,
-        MSG_STATUS_REQUEST = 7,
-        MSG_STATUS_RESPONSE = 8,
-        MSG_SHUTDOWN = 9
-    };
-
-    struct MessageHeader {
-        uint32_t type;
-        uint32_t length;
-        uint64_t transaction_id;
-        uint64_t timestamp;
-    } __attribute__((packed));
-
-    struct MemoryRequest {
-        uint64_t address;
-        uint32_t size;
-        uint32_t access_type;
-        uint8_t data[64];
-    } __attribute__((packed));
-
-    struct MemoryResponse {
-        uint64_t address;
-        uint32_t size;
-        uint32_t status;
-        uint8_t data[64];
-    } __attribute__((packed));
-
-    struct InitRequest {
-        uint64_t memory_size;
-        uint32_t page_size;
-        uint32_t cache_line_size;
-        char arch_name[32];
-    } __attribute__((packed));
-
-    struct StatusResponse {
-        uint64_t total_reads;
-        uint64_t total_writes;
-        uint64_t total_errors;
-        uint64_t current_bandwidth;
-        uint32_t active_banks;
-        uint32_t page_hits;
-        uint32_t page_misses;
-        uint32_t reserved;
-    } __attribute__((packed));
-}
+#include "openddr_seed.h"
+#include "qemu_systemc_protocol.h"
+#include "qemu_systemc_shm.h"
 
 class SystemCTestClient {
 public:
@@ -74,9 +27,28 @@ public:
     
     ~SystemCTestClient() {
         disconnect();
+        if (guest_ram != nullptr) {
+            munmap(guest_ram, guest_ram_size);
+        }
     }
     
+    // Connect to an AF_UNIX socket instead of host:port
+    void set_unix_socket(const std::string& path) { unix_path = path; }
+    
+    // Ask for the shared-memory ring transport at init (same host only)
+    void set_shm(bool enable) { request_shm = enable; }
+    
+    // Records per MSG_BATCH_REQUEST in the performance test's batched phase; 0 skips it
+    void set_batch_size(int records) { batch_size = records; }
+    
+    // Requests kept in flight in the performance test's pipelined phase; 0 skips it
+    void set_pipeline_depth(int depth) { pipeline_depth = depth; }
+    
     bool connect() {
+        if (!unix_path.empty()) {
+            return connect_unix();
+        }
+        
         socket_fd = socket(AF_INET, SOCK_STREAM, 0);
         if (socket_fd < 0) {
             std::cerr << "Failed to create socket" << std::endl;
@@ -100,10 +72,115 @@ public:
             return false;
         }
         
+        // Requests are small and each waits for its response: no Nagle delay
+        int one = 1;
+        setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        set_receive_timeout();
+        
         std::cout << "Connected to SystemC server at " << host << ":" << port << std::endl;
         return true;
     }
     
+    bool connect_unix() {
+        struct sockaddr_un server_addr;
+        memset(&server_addr, 0, sizeof(server_addr));
+        server_addr.sun_family = AF_UNIX;
+        if (unix_path.size() >= sizeof(server_addr.sun_path)) {
+            std::cerr << "Unix socket path too long: " << unix_path << std::endl;
+            return false;
+        }
+        strncpy(server_addr.sun_path, unix_path.c_str(), sizeof(server_addr.sun_path) - 1);
+        
+        socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket_fd < 0) {
+            std::cerr << "Failed to create socket" << std::endl;
+            return false;
+        }
+        if (::connect(socket_fd, (struct sockaddr*)&server_addr, sizeof(server_addr)) < 0) {
+            std::cerr << "Failed to connect to server " << unix_path << std::endl;
+            close(socket_fd);
+            socket_fd = -1;
+            return false;
+        }
+        
+        set_receive_timeout();
+        std::cout << "Connected to SystemC server at " << unix_path << std::endl;
+        return true;
+    }
+    
+    // Set once, so receiving a response costs no extra system call
+    void set_receive_timeout() {
+        struct timeval timeout;
+        timeout.tv_sec = RESPONSE_TIMEOUT_MS / 1000;
+        timeout.tv_usec = 0;
+        if (setsockopt(socket_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0) {
+            std::cerr << "Failed to set socket timeout" << std::endl;
+        }
+    }
+    
+    // Creates guest RAM as a memfd and hands it to the server (unix socket
+    // only); from then on the functional data lives there
+    bool attach_guest_ram(uint64_t size) {
+        int fd = memfd_create("openddr-guest-ram", MFD_CLOEXEC);
+        if (fd < 0 || ftruncate(fd, size) != 0) {
+            std::cerr << "Failed to create guest RAM memfd: " << strerror(errno) << std::endl;
+            if (fd >= 0) {
+                close(fd);
+            }
+            return false;
+        }
+        void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) {
+            std::cerr << "Failed to map guest RAM: " << strerror(errno) << std::endl;
+            close(fd);
+            return false;
+        }
+        guest_ram = static_cast<uint8_t*>(map);
+        guest_ram_size = size;
+        
+        QemuSystemC::MemfdAttachRequest request;
+        request.guest_base = 0;
+        request.size = size;
+        QemuSystemC::MessageHeader header = make_header(QemuSystemC::MSG_MEMFD_ATTACH, sizeof(request));
+        
+        // Header and request in one sendmsg, the fd riding along as SCM_RIGHTS
+        struct iovec iov[2] = {{&header, sizeof(header)}, {&request, sizeof(request)}};
+        alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        memset(control, 0, sizeof(control));
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = 2;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+        
+        ssize_t sent = sendmsg(socket_fd, &msg, 0);
+        close(fd);  // The server holds its own reference once it is received
+        if (sent != (ssize_t)(sizeof(header) + sizeof(request))) {
+            std::cerr << "Failed to send guest RAM memfd" << std::endl;
+            return false;
+        }
+        
+        QemuSystemC::MessageHeader reply;
+        std::vector<uint8_t> data;
+        uint32_t status = 1;
+        if (receive_message(reply, data) && reply.type == QemuSystemC::MSG_MEMFD_ATTACH_RESPONSE &&
+            data.size() >= sizeof(status)) {
+            memcpy(&status, data.data(), sizeof(status));
+        }
+        if (status != 0) {
+            std::cerr << "Server did not attach the guest RAM memfd" << std::endl;
+            return false;
+        }
+        std::cout << "Guest RAM memfd attached (" << (size >> 20) << " MB)" << std::endl;
+        return true;
+    }
+    
     void disconnect() {
         if (socket_fd >= 0) {
             close(socket_fd);
@@ -113,16 +190,39 @@ public:
     
     bool send_init_request(uint64_t memory_size, const std::string& arch) {
         QemuSystemC::InitRequest request;
+        memset(&request, 0, sizeof(request));
         request.memory_size = memory_size;
         request.page_size = 4096;
         request.cache_line_size = 64;
         strncpy(request.arch_name, arch.c_str(), sizeof(request.arch_name) - 1);
         request.arch_name[sizeof(request.arch_name) - 1] = '\0';
+        if (request_shm) {
+            request.transport_flags |= QemuSystemC::TRANSPORT_SHM_RING;
+        }
+        if (pipeline_depth > 0) {
+            request.transport_flags |= QemuSystemC::TRANSPORT_PIPELINED;
+        }
+        request.transport_flags |= QemuSystemC::TRANSPORT_VARIABLE_PAYLOAD;
         
         return send_message(QemuSystemC::MSG_INIT_REQUEST, &request, sizeof(request));
     }
     
     bool send_write_request(uint64_t address, const uint8_t* data, uint32_t size) {
+        if (guest_ram != nullptr && address + size <= guest_ram_size) {
+            memcpy(guest_ram + address, data, size);  // The server reads it from here
+        }
+        
+        if (variable_payload) {
+            QemuSystemC::AccessRequest request;
+            request.address = address;
+            request.size = size;
+            request.access_type = 1; // Write
+            std::vector<uint8_t> payload(sizeof(request) + size);
+            memcpy(payload.data(), &request, sizeof(request));
+            memcpy(payload.data() + sizeof(request), data, size);
+            return send_message(QemuSystemC::MSG_WRITE_REQUEST, payload.data(), payload.size());
+        }
+        
         QemuSystemC::MemoryRequest request;
         request.address = address;
         request.size = size;
@@ -133,6 +233,14 @@ public:
     }
     
     bool send_read_request(uint64_t address, uint32_t size) {
+        if (variable_payload) {
+            QemuSystemC::AccessRequest request;
+            request.address = address;
+            request.size = size;
+            request.access_type = 0; // Read
+            return send_message(QemuSystemC::MSG_READ_REQUEST, &request, sizeof(request));
+        }
+        
         QemuSystemC::MemoryRequest request;
         request.address = address;
         request.size = size;
@@ -146,26 +254,20 @@ public:
         return send_message(QemuSystemC::MSG_STATUS_REQUEST, nullptr, 0);
     }
     
+    bool send_ext_status_request() {
+        return send_message(QemuSystemC::MSG_EXT_STATUS_REQUEST, nullptr, 0);
+    }
+    
+    static void print_latency(const char* name, const QemuSystemC::LatencySummary& summary, const char* unit) {
+        std::cout << "  " << name << summary.count << " samples, p50 " << summary.p50 << " " << unit
+                  << ", p99 " << summary.p99 << " " << unit << ", p99.9 " << summary.p999 << " " << unit
+                  << ", max " << summary.max << " " << unit << std::endl;
+    }
+    
     bool receive_response(QemuSystemC::MessageType expected_type) {
-        // Set socket timeout to prevent indefinite blocking
-        struct timeval timeout;
-        timeout.tv_sec = 5;  // 5 second timeout
-        timeout.tv_usec = 0;
-        
-        if (setsockopt(socket_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0) {
-            std::cerr << "Failed to set socket timeout" << std::endl;
-        }
-        
         QemuSystemC::MessageHeader header;
-        ssize_t received = recv(socket_fd, &header, sizeof(header), MSG_WAITALL);
-        if (received != sizeof(header)) {
-            if (received == 0) {
-                std::cerr << "Connection closed by server" << std::endl;
-            } else if (received < 0) {
-                std::cerr << "Failed to receive response header (timeout or error)" << std::endl;
-            } else {
-                std::cerr << "Partial header received: " << received << " bytes" << std::endl;
-            }
+        std::vector<uint8_t> data;
+        if (!receive_message(header, data)) {
             return false;
         }
         
@@ -176,34 +278,53 @@ public:
         }
         
         if (header.length > 0) {
-            std::vector<uint8_t> data(header.length);
-            if (recv(socket_fd, data.data(), header.length, MSG_WAITALL) != (ssize_t)header.length) {
-                std::cerr << "Failed to receive response data" << std::endl;
-                return false;
-            }
-            
             // Process response data based on type
             switch (expected_type) {
+                case QemuSystemC::MSG_INIT_RESPONSE: {
+                    QemuSystemC::InitResponse response;
+                    memset(&response, 0, sizeof(response));
+                    memcpy(&response, data.data(), std::min(data.size(), sizeof(response)));
+                    if (!switch_transport(response)) {
+                        return false;
+                    }
+                    break;
+                }
+                
+
                 case QemuSystemC::MSG_READ_RESPONSE: {
-                    QemuSystemC::MemoryResponse* response = (QemuSystemC::MemoryResponse*)data.data();
-                    std::cout << "Read response: addr=0x" << std::hex << response->address
-                              << " size=" << std::dec << response->size
-                              << " status=" << response->status;
-                    if (response->status == 0) {
+                    AccessResult response;
+                    if (!decode_access_response(data, response)) {
+                        return false;
+                    }
+                    std::cout << "Read response: addr=0x" << std::hex << response.address
+                              << " size=" << std::dec << response.size
+                              << " status=" << response.status;
+                    if (response.status == 0) {
                         std::cout << " data=0x" << std::hex;
-                        for (uint32_t i = 0; i < std::min(response->size, 8u); i++) {
-                            std::cout << std::setfill('0') << std::setw(2) << (int)response->data[i];
+                        for (size_t i = 0; i < std::min(response.data.size(), (size_t)8); i++) {
+                            std::cout << std::setfill('0') << std::setw(2) << (int)response.data[i];
+                        }
+                        if (response.data.size() > 8) {
+                            std::cout << "...";
                         }
                     }
-                    std::cout << std::dec << std::endl;
+                    std::cout << std::dec;
+                    record_latency(response.latency_ps);
+                    std::cout << std::endl;
+                    last_read_data = std::move(response.data);
                     break;
                 }
                 
                 case QemuSystemC::MSG_WRITE_RESPONSE: {
-                    QemuSystemC::MemoryResponse* response = (QemuSystemC::MemoryResponse*)data.data();
-                    std::cout << "Write response: addr=0x" << std::hex << response->address
-                              << " size=" << std::dec << response->size
-                              << " status=" << response->status << std::endl;
+                    AccessResult response;
+                    if (!decode_access_response(data, response)) {
+                        return false;
+                    }
+                    std::cout << "Write response: addr=0x" << std::hex << response.address
+                              << " size=" << std::dec << response.size
+                              << " status=" << response.status;
+                    record_latency(response.latency_ps);
+                    std::cout << std::endl;
                     break;
                 }
                 
@@ -220,6 +341,41 @@ public:
                     break;
                 }
                 
+                case QemuSystemC::MSG_EXT_STATUS_RESPONSE: {
+                    QemuSystemC::ExtStatusResponse status;
+                    memset(&status, 0, sizeof(status));
+                    memcpy(&status, data.data(), std::min(data.size(), sizeof(status)));
+                    std::cout << "Extended status (sim time " << status.sim_time_ps / 1000 << " ns):" << std::endl;
+                    std::cout << "  Bandwidth:      read " << (status.read_bandwidth >> 10) << " KB/s, write "
+                              << (status.write_bandwidth >> 10) << " KB/s" << std::endl;
+                    std::cout << "  Model:          " << status.model_reads << " reads, " << status.model_writes
+                              << " writes, " << status.ddr_commands << " DDR commands" << std::endl;
+                    std::cout << "  Pages:          " << status.page_hits << " hits, " << status.page_misses
+                              << " misses (" << status.page_conflicts << " conflicts), "
+                              << status.open_banks << " banks open" << std::endl;
+                    std::cout << "  Bank accesses: ";
+                    for (uint32_t i = 0; i < QemuSystemC::STATUS_BANKS; i++) {
+                        std::cout << " " << status.bank_accesses[i];
+                    }
+                    std::cout << std::endl;
+                    std::cout << "  Queue HWM:      waddr " << status.write_addr_queue_hwm
+                              << " wdata " << status.write_data_queue_hwm
+                              << " wresp " << status.write_resp_queue_hwm
+                              << " raddr " << status.read_addr_queue_hwm
+                              << " rresp " << status.read_resp_queue_hwm
+                              << " cmd " << status.ddr_cmd_queue_hwm << std::endl;
+                    QemuSystemC::LatencySummary summary;
+                    summary = status.read_sim_ps;
+                    print_latency("Read (sim):     ", summary, "ps");
+                    summary = status.write_sim_ps;
+                    print_latency("Write (sim):    ", summary, "ps");
+                    summary = status.read_wall_ns;
+                    print_latency("Read (wall):    ", summary, "ns");
+                    summary = status.write_wall_ns;
+                    print_latency("Write (wall):   ", summary, "ns");
+                    break;
+                }
+                
                 default:
                     std::cout << "Response received (type=" << expected_type << ")" << std::endl;
                     break;
@@ -269,6 +425,12 @@ public:
             return false;
         }
         
+        // A cache line at an unaligned address and a whole page, split into
+        // beats by the server
+        if (variable_payload && (!check_transfer(0x2003, 64) || !check_transfer(0x10000, 4096))) {
+            return false;
+        }
+        
         std::cout << "Basic test completed successfully!" << std::endl;
         return true;
     }
@@ -298,24 +460,20 @@ public:
             return false;
         }
         
-        const int num_operations = 20;  // Reduced from 50 to prevent queue overflow
-        std::random_device rd;
-        std::mt19937 gen(rd());
+        // One request at a time stays within any credit grant, so no pacing
+        // is needed; the pipelined phase uses the full grant
+        const int num_operations = 50;
+        std::mt19937 gen = OpenDDRSeed::rng("test_client.performance");
         std::uniform_int_distribution<uint64_t> addr_dist(0, 1024 * 1024);
         std::uniform_int_distribution<uint64_t> data_dist(0, UINT64_MAX);
         
-        // Pacing parameters to prevent queue overflow
-        const auto request_pacing = std::chrono::microseconds(100);  // 100μs between requests
-        const auto burst_pacing = std::chrono::milliseconds(10);     // 10ms between bursts
-        const int burst_size = 5;  // Send 5 operations, then pause
-        
         auto start_time = std::chrono::high_resolution_clock::now();
         int successful_writes = 0;
         int failed_writes = 0;
         
-        // Perform write operations with pacing
+        // Perform write operations
         std::cout << "\n--- Write Operations Phase ---" << std::endl;
-        std::cout << "Performing " << num_operations << " write operations with pacing..." << std::endl;
+        std::cout << "Performing " << num_operations << " write operations..." << std::endl;
         for (int i = 0; i < num_operations; i++) {
             uint64_t addr = (addr_dist(gen) & ~7ULL); // 8-byte aligned
             uint64_t data = data_dist(gen);
@@ -330,21 +488,10 @@ public:
             }
             successful_writes++;
             
-            // Add pacing between requests
-            std::this_thread::sleep_for(request_pacing);
-            
-            // Add burst pacing after every burst_size operations
-            if ((i + 1) % burst_size == 0) {
-                std::cout << "  Burst completed: " << (i + 1) << "/" << num_operations 
-                          << " (" << std::fixed << std::setprecision(1) 
-                          << (100.0 * (i + 1) / num_operations) << "%)" << std::endl;
-                std::this_thread::sleep_for(burst_pacing);
-            }
-            
             if ((i + 1) % 10 == 0) {
                 auto current_time = std::chrono::high_resolution_clock::now();
-                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - start_time);
-                double ops_per_sec = (double)(i + 1) / (elapsed.count() / 1000.0);
+                std::chrono::duration<double> elapsed = current_time - start_time;
+                double ops_per_sec = (double)(i + 1) / elapsed.count();
                 
                 std::cout << "  Progress: " << (i + 1) << "/" << num_operations 
                           << " writes (" << std::fixed << std::setprecision(1) 
@@ -359,9 +506,9 @@ public:
         int successful_reads = 0;
         int failed_reads = 0;
         
-        // Perform read operations with pacing
+        // Perform read operations
         std::cout << "\n--- Read Operations Phase ---" << std::endl;
-        std::cout << "Performing " << num_operations << " read operations with pacing..." << std::endl;
+        std::cout << "Performing " << num_operations << " read operations..." << std::endl;
         for (int i = 0; i < num_operations; i++) {
             uint64_t addr = (addr_dist(gen) & ~7ULL); // 8-byte aligned
             
@@ -375,21 +522,10 @@ public:
             }
             successful_reads++;
             
-            // Add pacing between requests
-            std::this_thread::sleep_for(request_pacing);
-            
-            // Add burst pacing after every burst_size operations
-            if ((i + 1) % burst_size == 0) {
-                std::cout << "  Burst completed: " << (i + 1) << "/" << num_operations 
-                          << " (" << std::fixed << std::setprecision(1) 
-                          << (100.0 * (i + 1) / num_operations) << "%)" << std::endl;
-                std::this_thread::sleep_for(burst_pacing);
-            }
-            
             if ((i + 1) % 10 == 0) {
                 auto current_time = std::chrono::high_resolution_clock::now();
-                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - start_time);
-                double ops_per_sec = (double)(successful_writes + i + 1) / (elapsed.count() / 1000.0);
+                std::chrono::duration<double> elapsed = current_time - start_time;
+                double ops_per_sec = (double)(successful_writes + i + 1) / elapsed.count();
                 
                 std::cout << "  Progress: " << (i + 1) << "/" << num_operations 
                           << " reads (" << std::fixed << std::setprecision(1) 
@@ -401,19 +537,36 @@ public:
         std::cout << "Read phase completed: " << successful_reads << " successful, " 
                   << failed_reads << " failed" << std::endl;
         
+        int successful_batched = 0;
+        int failed_batched = 0;
+        if (batch_size > 0) {
+            run_batched_phase(gen, num_operations, successful_batched, failed_batched);
+        }
+        if (pipeline_depth > 0) {
+            run_pipelined_phase(gen, num_operations, successful_batched, failed_batched);
+        }
+        
         auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+        // Unpaced runs can finish within a millisecond
+        std::chrono::duration<double, std::milli> duration = end_time - start_time;
         
         std::cout << "\n--- Performance Test Results ---" << std::endl;
-        std::cout << "Total test duration: " << duration.count() << " ms" << std::endl;
-        std::cout << "Total operations: " << (successful_writes + successful_reads) << std::endl;
+        std::cout << "Total test duration: " << std::fixed << std::setprecision(3) << duration.count() << " ms" << std::endl;
+        std::cout << "Total operations: " << (successful_writes + successful_reads + successful_batched) << std::endl;
         std::cout << "Successful writes: " << successful_writes << std::endl;
         std::cout << "Successful reads: " << successful_reads << std::endl;
-        std::cout << "Failed operations: " << (failed_writes + failed_reads) << std::endl;
+        if (batch_size > 0 || pipeline_depth > 0) {
+            std::cout << "Successful batched/pipelined: " << successful_batched << std::endl;
+        }
+        std::cout << "Failed operations: " << (failed_writes + failed_reads + failed_batched) << std::endl;
         std::cout << "Average operation time: " << std::fixed << std::setprecision(3) 
-                  << (duration.count() / (double)(successful_writes + successful_reads)) << " ms" << std::endl;
+                  << (duration.count() / (double)(successful_writes + successful_reads + successful_batched)) << " ms" << std::endl;
         std::cout << "Overall throughput: " << std::setprecision(2) 
-                  << ((successful_writes + successful_reads) / (duration.count() / 1000.0)) << " ops/sec" << std::endl;
+                  << ((successful_writes + successful_reads + successful_batched) / (duration.count() / 1000.0)) << " ops/sec" << std::endl;
+        if (latency_samples > 0) {
+            std::cout << "Average simulated latency: " << std::setprecision(1)
+                      << (total_latency_ps / 1000.0 / latency_samples) << " ns" << std::endl;
+        }
         
         // Get final status
         std::cout << "\nFinal system status:" << std::endl;
@@ -423,42 +576,400 @@ public:
         if (!receive_response(QemuSystemC::MSG_STATUS_RESPONSE)) {
             return false;
         }
+        if (!send_ext_status_request()) {
+            return false;
+        }
+        if (!receive_response(QemuSystemC::MSG_EXT_STATUS_RESPONSE)) {
+            return false;
+        }
         
         return true;
     }
 
 private:
+    // Writes num_operations random words in batches, then reads them back in
+    // batches and checks every record's transaction ID, status and data
+    void run_batched_phase(std::mt19937& gen, int num_operations, int& successful, int& failed) {
+        std::vector<uint64_t> addresses;
+        std::vector<uint64_t> values;
+        make_test_words(gen, num_operations, addresses, values);
+        
+        std::cout << "\n--- Batched Operations Phase ---" << std::endl;
+        std::cout << "Performing " << num_operations << " writes and reads in batches of "
+                  << batch_size << "..." << std::endl;
+        for (int pass = 0; pass < 2; pass++) {
+            bool is_write = pass == 0;
+            for (int first = 0; first < num_operations; first += batch_size) {
+                int count = std::min(batch_size, num_operations - first);
+                std::vector<QemuSystemC::BatchRequestRecord> records(count);
+                for (int i = 0; i < count; i++) {
+                    QemuSystemC::BatchRequestRecord& record = records[i];
+                    memset(&record, 0, sizeof(record));
+                    record.transaction_id = transaction_id++;
+                    record.address = addresses[first + i];
+                    record.size = 8;
+                    record.access_type = is_write ? 1 : 0;
+                    if (is_write) {
+                        memcpy(record.data, &values[first + i], sizeof(record.data));
+                        if (guest_ram != nullptr && record.address + 8 <= guest_ram_size) {
+                            memcpy(guest_ram + record.address, record.data, 8);
+                        }
+                    }
+                }
+                
+                std::vector<QemuSystemC::BatchResponseRecord> responses;
+                if (!send_batch(records) || !receive_batch(responses) || responses.size() != records.size()) {
+                    failed += count;
+                    continue;
+                }
+                for (int i = 0; i < count; i++) {
+                    uint64_t data;
+                    memcpy(&data, responses[i].data, sizeof(data));
+                    bool ok = responses[i].transaction_id == records[i].transaction_id &&
+                              responses[i].status == 0 && (is_write || data == values[first + i]);
+                    if (ok) {
+                        successful++;
+                    } else {
+                        failed++;
+                        std::cerr << "  Batched " << (is_write ? "write" : "read") << " at 0x" << std::hex
+                                  << records[i].address << std::dec << " failed (status "
+                                  << responses[i].status << ")" << std::endl;
+                    }
+                    if (responses[i].latency_ps > 0) {
+                        total_latency_ps += responses[i].latency_ps;
+                        latency_samples++;
+                    }
+                }
+            }
+        }
+        std::cout << "Batched phase completed: " << successful << " successful, " << failed << " failed" << std::endl;
+    }
+    
+    // Keeps up to pipeline_depth single requests in flight (fewer if the
+    // server granted fewer credits), writes first and
+    // then the read-back, matching each response to its request by
+    // transaction ID since a pipelined server answers in completion order
+    void run_pipelined_phase(std::mt19937& gen, int num_operations, int& successful, int& failed) {
+        std::vector<uint64_t> addresses;
+        std::vector<uint64_t> values;
+        make_test_words(gen, num_operations, addresses, values);
+        
+        // Never more than the server's credits, so it never has to stall us
+        const int window = std::min(pipeline_depth, credits);
+        std::cout << "\n--- Pipelined Operations Phase ---" << std::endl;
+        std::cout << "Performing " << num_operations << " writes and reads, up to "
+                  << window << " in flight..." << std::endl;
+        int out_of_order = 0;
+        for (int pass = 0; pass < 2; pass++) {
+            bool is_write = pass == 0;
+            std::map<uint64_t, int> outstanding;  // transaction ID -> operation
+            int next = 0;
+            while (next < num_operations || !outstanding.empty()) {
+                while (next < num_operations && (int)outstanding.size() < window) {
+                    uint64_t id = transaction_id;
+                    bool sent = is_write ? send_write_request(addresses[next], (uint8_t*)&values[next], 8)
+                                         : send_read_request(addresses[next], 8);
+                    if (sent) {
+                        outstanding[id] = next;
+                    } else {
+                        failed++;
+                    }
+                    next++;
+                }
+                if (outstanding.empty()) {
+                    continue;
+                }
+                
+                QemuSystemC::MessageHeader header;
+                std::vector<uint8_t> data;
+                if (!receive_message(header, data)) {
+                    failed += outstanding.size();
+                    break;  // Nothing more will arrive
+                }
+                auto it = outstanding.find(header.transaction_id);
+                AccessResult response;
+                if (it == outstanding.end() || !decode_access_response(data, response)) {
+                    std::cerr << "  Unmatched response, transaction " << header.transaction_id << std::endl;
+                    continue;
+                }
+                if (it != outstanding.begin()) {
+                    out_of_order++;
+                }
+                int op = it->second;
+                outstanding.erase(it);
+                
+                uint64_t value = 0;
+                memcpy(&value, response.data.data(), std::min(response.data.size(), sizeof(value)));
+                if (response.status == 0 && (is_write || value == values[op])) {
+                    successful++;
+                } else {
+                    failed++;
+                    std::cerr << "  Pipelined " << (is_write ? "write" : "read") << " at 0x" << std::hex
+                              << addresses[op] << std::dec << " failed (status " << response.status << ")" << std::endl;
+                }
+                if (response.latency_ps > 0) {
+                    total_latency_ps += response.latency_ps;
+                    latency_samples++;
+                }
+            }
+        }
+        std::cout << "Pipelined phase completed: " << successful << " successful, " << failed << " failed, "
+                  << out_of_order << " responses out of order" << std::endl;
+    }
+    
+    // One random word per 1 MB / count slice, so addresses are distinct and
+    // every read-back compares against its own write
+    static void make_test_words(std::mt19937& gen, int count, std::vector<uint64_t>& addresses,
+                                std::vector<uint64_t>& values) {
+        const uint64_t slice = (1024 * 1024 / count) & ~7ULL;
+        std::uniform_int_distribution<uint64_t> offset_dist(0, slice - 8);
+        std::uniform_int_distribution<uint64_t> data_dist(0, UINT64_MAX);
+        addresses.resize(count);
+        values.resize(count);
+        for (int i = 0; i < count; i++) {
+            addresses[i] = i * slice + (offset_dist(gen) & ~7ULL);
+            values[i] = data_dist(gen);
+        }
+    }
+    
+    bool send_batch(const std::vector<QemuSystemC::BatchRequestRecord>& records) {
+        QemuSystemC::BatchHeader batch = {(uint32_t)records.size(), 0};
+        std::vector<uint8_t> payload(sizeof(batch) + records.size() * sizeof(records[0]));
+        memcpy(payload.data(), &batch, sizeof(batch));
+        memcpy(payload.data() + sizeof(batch), records.data(), records.size() * sizeof(records[0]));
+        return send_message(QemuSystemC::MSG_BATCH_REQUEST, payload.data(), payload.size());
+    }
+    
+    bool receive_batch(std::vector<QemuSystemC::BatchResponseRecord>& responses) {
+        QemuSystemC::MessageHeader header;
+        std::vector<uint8_t> data;
+        if (!receive_message(header, data)) {
+            return false;
+        }
+        QemuSystemC::BatchHeader batch;
+        if (header.type != QemuSystemC::MSG_BATCH_RESPONSE || data.size() < sizeof(batch)) {
+            std::cerr << "Unexpected response type: " << header.type
+                      << " (expected " << QemuSystemC::MSG_BATCH_RESPONSE << ")" << std::endl;
+            return false;
+        }
+        memcpy(&batch, data.data(), sizeof(batch));
+        if (data.size() < sizeof(batch) + batch.count * sizeof(QemuSystemC::BatchResponseRecord)) {
+            std::cerr << "Truncated batch response" << std::endl;
+            return false;
+        }
+        responses.resize(batch.count);
+        memcpy(responses.data(), data.data() + sizeof(batch), batch.count * sizeof(QemuSystemC::BatchResponseRecord));
+        return true;
+    }
+    
     std::string host;
     int port;
     int socket_fd;
     uint64_t transaction_id = 1;
+    std::string unix_path;
     
-    bool send_message(QemuSystemC::MessageType type, const void* data, uint32_t size) {
+    // Guest RAM shared with the server (--memfd)
+    uint8_t* guest_ram = nullptr;
+    uint64_t guest_ram_size = 0;
+    
+    // Optional performance test phases
+    int batch_size = 0;
+    int pipeline_depth = 0;
+    
+    // Accesses the server lets us have unanswered, from its InitResponse
+    int credits = 1;
+    
+    // Shared-memory rings, once the server has accepted TRANSPORT_SHM_RING
+    bool request_shm = false;
+    std::unique_ptr<QemuSystemC::ShmRegion> shm;
+    static constexpr int RESPONSE_TIMEOUT_MS = 5000;
+    
+    // Received bytes not yet returned as responses: [rx_begin, rx_end)
+    std::vector<uint8_t> rx;
+    size_t rx_begin = 0;
+    size_t rx_end = 0;
+    static constexpr size_t RX_BUFFER_SIZE = 64 * 1024;
+    
+    bool receive_message(QemuSystemC::MessageHeader& header, std::vector<uint8_t>& data) {
+        if (shm) {
+            if (!shm->responses().pop(header, data, RESPONSE_TIMEOUT_MS)) {
+                std::cerr << "Failed to receive response (timeout on the response ring)" << std::endl;
+                return false;
+            }
+            return true;
+        }
+        
+        // Responses are cut out of a receive buffer, so pipelined responses
+        // that arrive together cost one recv
+        for (;;) {
+            size_t available = rx_end - rx_begin;
+            size_t needed = sizeof(header);
+            if (available >= sizeof(header)) {
+                memcpy(&header, rx.data() + rx_begin, sizeof(header));
+                needed += header.length;
+                if (available >= needed) {
+                    const uint8_t* payload = rx.data() + rx_begin + sizeof(header);
+                    data.assign(payload, payload + header.length);
+                    rx_begin += needed;
+                    return true;
+                }
+            }
+            
+            if (rx_begin > 0) {
+                memmove(rx.data(), rx.data() + rx_begin, available);
+                rx_begin = 0;
+                rx_end = available;
+            }
+            if (rx.size() < std::max(needed, RX_BUFFER_SIZE)) {
+                rx.resize(std::max(needed, RX_BUFFER_SIZE));
+            }
+            ssize_t received = recv(socket_fd, rx.data() + rx_end, rx.size() - rx_end, 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received <= 0) {
+                if (received == 0) {
+                    std::cerr << "Connection closed by server" << std::endl;
+                } else {
+                    std::cerr << "Failed to receive response (timeout or error)" << std::endl;
+                }
+                return false;
+            }
+            rx_end += received;
+        }
+    }
+    
+    // Follows the transport the server picked in its InitResponse
+    bool switch_transport(const QemuSystemC::InitResponse& response) {
+        variable_payload = response.transport_flags & QemuSystemC::TRANSPORT_VARIABLE_PAYLOAD;
+        if (pipeline_depth > 0 && !(response.transport_flags & QemuSystemC::TRANSPORT_PIPELINED)) {
+            std::cout << "Server does not pipeline; responses will arrive in order" << std::endl;
+        }
+        credits = std::max(1, static_cast<int>(response.credits));
+        std::cout << "Server granted " << credits << " credit" << (credits == 1 ? "" : "s") << std::endl;
+        if (!(response.transport_flags & QemuSystemC::TRANSPORT_SHM_RING)) {
+            if (request_shm) {
+                std::cout << "Server declined the shared-memory transport, using the socket" << std::endl;
+            }
+            return true;
+        }
+        std::string name(response.shm_name, strnlen(response.shm_name, sizeof(response.shm_name)));
+        std::string error;
+        auto region = std::make_unique<QemuSystemC::ShmRegion>();
+        if (!region->attach(name, error)) {
+            std::cerr << "Failed to attach shared-memory rings: " << error << std::endl;
+            return false;
+        }
+        shm = std::move(region);
+        std::cout << "Using shared-memory rings " << name << std::endl;
+        return true;
+    }
+    
+    // Simulated latency reported by a --timed server
+    uint64_t total_latency_ps = 0;
+    uint64_t latency_samples = 0;
+    
+    void record_latency(uint64_t latency_ps) {
+        if (latency_ps > 0) {
+            std::cout << " latency=" << latency_ps / 1000.0 << "ns";
+            total_latency_ps += latency_ps;
+            latency_samples++;
+        }
+    }
+    
+    // Responses are AccessResponse + data once TRANSPORT_VARIABLE_PAYLOAD is
+    // accepted, MemoryResponse before
+    bool variable_payload = false;
+    std::vector<uint8_t> last_read_data;
+    
+    struct AccessResult {
+        uint64_t address;
+        uint32_t size;
+        uint32_t status;
+        uint64_t latency_ps;
+        std::vector<uint8_t> data;     // Read data
+    };
+    
+    bool decode_access_response(const std::vector<uint8_t>& data, AccessResult& result) {
+        if (variable_payload) {
+            QemuSystemC::AccessResponse response;
+            if (data.size() < sizeof(response)) {
+                std::cerr << "Truncated access response" << std::endl;
+                return false;
+            }
+            memcpy(&response, data.data(), sizeof(response));
+            result = {response.address, response.size, response.status, response.latency_ps,
+                      std::vector<uint8_t>(data.begin() + sizeof(response), data.end())};
+            return true;
+        }
+        QemuSystemC::MemoryResponse response;
+        if (data.size() < sizeof(response)) {
+            std::cerr << "Truncated memory response" << std::endl;
+            return false;
+        }
+        memcpy(&response, data.data(), sizeof(response));
+        result = {response.address, response.size, response.status, response.latency_ps,
+                  std::vector<uint8_t>(response.data, response.data + std::min(response.size, (uint32_t)sizeof(response.data)))};
+        return true;
+    }
+    
+    // Writes size bytes of a counting pattern at address and reads them back
+    bool check_transfer(uint64_t address, uint32_t size) {
+        std::vector<uint8_t> pattern(size);
+        for (uint32_t i = 0; i < size; i++) {
+            pattern[i] = static_cast<uint8_t>(i * 7 + (address >> 4));
+        }
+        std::cout << "Transferring " << size << " bytes at 0x" << std::hex << address << std::dec << std::endl;
+        if (!send_write_request(address, pattern.data(), size) ||
+            !receive_response(QemuSystemC::MSG_WRITE_RESPONSE) ||
+            !send_read_request(address, size) ||
+            !receive_response(QemuSystemC::MSG_READ_RESPONSE)) {
+            return false;
+        }
+        if (last_read_data != pattern) {
+            std::cerr << "Read-back of " << size << " bytes at 0x" << std::hex << address << std::dec
+                      << " does not match the data written" << std::endl;
+            return false;
+        }
+        return true;
+    }
+    
+    QemuSystemC::MessageHeader make_header(QemuSystemC::MessageType type, uint32_t size) {
         QemuSystemC::MessageHeader header;
         header.type = type;
         header.length = size;
         header.transaction_id = transaction_id++;
         header.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
             std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+        return header;
+    }
+    
+    bool send_message(QemuSystemC::MessageType type, const void* data, uint32_t size) {
+        QemuSystemC::MessageHeader header = make_header(type, size);
         
-        // Send header
-        if (send(socket_fd, &header, sizeof(header), 0) != sizeof(header)) {
-            std::cerr << "Failed to send message header" << std::endl;
-            return false;
-        }
-        
-        // Send data if present
-        if (size > 0 && data != nullptr) {
-            if (send(socket_fd, data, size, 0) != (ssize_t)size) {
-                std::cerr << "Failed to send message data" << std::endl;
+        if (shm) {
+            if (!shm->requests().push(header, data, data ? size : 0, RESPONSE_TIMEOUT_MS)) {
+                std::cerr << "Failed to queue message on the request ring" << std::endl;
                 return false;
             }
+            return true;
+        }
+        
+        // Header and data in one writev
+        struct iovec iov[2] = {{&header, sizeof(header)}, {const_cast<void*>(data), data ? size : 0}};
+        size_t total = sizeof(header) + iov[1].iov_len;
+        if (writev(socket_fd, iov, iov[1].iov_len > 0 ? 2 : 1) != (ssize_t)total) {
+            std::cerr << "Failed to send message" << std::endl;
+            return false;
         }
         
         return true;
     }
 };
 
+// Covers every address the basic and performance tests touch
+static const uint64_t GUEST_RAM_SIZE = 16ULL << 20;
+
 void print_usage(const char* program_name) {
     std::cout << "Usage: " << program_name << " [OPTIONS]" << std::endl;
     std::cout << std::endl;
@@ -467,6 +978,12 @@ void print_usage(const char* program_name) {
     std::cout << "Options:" << std::endl;
     std::cout << "  -s, --server HOST:PORT   Server address (default: localhost:8888)" << std::endl;
     std::cout << "  -t, --test TYPE          Test type: basic, performance (default: basic)" << std::endl;
+    std::cout << "  -u, --unix-socket PATH   Connect to the server's AF_UNIX socket instead of --server" << std::endl;
+    std::cout << "  -f, --memfd              Share guest RAM with the server as a memfd (needs --unix-socket)" << std::endl;
+    std::cout << "  -b, --batch N            Add a batched phase to the performance test, N accesses per frame" << std::endl;
+    std::cout << "  -P, --pipeline N         Add a pipelined phase to the performance test, N requests in flight" << std::endl;
+    std::cout << "  -m, --shm                Use the shared-memory ring transport (server on this host)" << std::endl;
+    std::cout << "  -e, --seed N             Random seed (default: OPENDDR_SEED or " << OpenDDRSeed::DEFAULT_SEED << ")" << std::endl;
     std::cout << "  -h, --help               Show this help" << std::endl;
     std::cout << std::endl;
     std::cout << "Examples:" << std::endl;
@@ -477,11 +994,22 @@ void print_usage(const char* program_name) {
 int main(int argc, char* argv[]) {
     std::string server_address = "localhost:8888";
     std::string test_type = "basic";
+    bool use_shm = false;
+    int batch_size = 0;
+    int pipeline_depth = 0;
+    bool use_memfd = false;
+    std::string unix_socket = "";
     
     // Command line options
     static struct option long_options[] = {
         {"server", required_argument, 0, 's'},
         {"test",   required_argument, 0, 't'},
+        {"seed",   required_argument, 0, 'e'},
+        {"shm",    no_argument,       0, 'm'},
+        {"batch",  required_argument, 0, 'b'},
+        {"pipeline", required_argument, 0, 'P'},
+        {"unix-socket", required_argument, 0, 'u'},
+        {"memfd",  no_argument,       0, 'f'},
         {"help",   no_argument,       0, 'h'},
         {0, 0, 0, 0}
     };
@@ -489,7 +1017,10 @@ int main(int argc, char* argv[]) {
     int option_index = 0;
     int c;
     
-    while ((c = getopt_long(argc, argv, "s:t:h", long_options, &option_index)) != -1) {
+    // --seed overrides OPENDDR_SEED
+    OpenDDRSeed::configure_from_env();
+    
+    while ((c = getopt_long(argc, argv, "s:t:e:mb:P:u:fh", long_options, &option_index)) != -1) {
         switch (c) {
             case 's':
                 server_address = optarg;
@@ -504,6 +1035,44 @@ int main(int argc, char* argv[]) {
                 }
                 break;
                 
+            case 'e': {
+                uint64_t seed;
+                if (!OpenDDRSeed::parse(optarg, seed)) {
+                    std::cerr << "Error: Invalid seed: " << optarg << std::endl;
+                    return 1;
+                }
+                OpenDDRSeed::set_global(seed);
+                break;
+            }
+                
+            case 'm':
+                use_shm = true;
+                break;
+                
+            case 'b':
+                batch_size = std::atoi(optarg);
+                if (batch_size <= 0 || batch_size > (int)QemuSystemC::MAX_BATCH_RECORDS) {
+                    std::cerr << "Error: Batch size must be 1.." << QemuSystemC::MAX_BATCH_RECORDS << std::endl;
+                    return 1;
+                }
+                break;
+                
+            case 'P':
+                pipeline_depth = std::atoi(optarg);
+                if (pipeline_depth <= 0) {
+                    std::cerr << "Error: Pipeline depth must be positive" << std::endl;
+                    return 1;
+                }
+                break;
+                
+            case 'u':
+                unix_socket = optarg;
+                break;
+                
+            case 'f':
+                use_memfd = true;
+                break;
+                
             case 'h':
                 print_usage(argv[0]);
                 return 0;
@@ -532,17 +1101,29 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
+    if (use_memfd && unix_socket.empty()) {
+        std::cerr << "Error: --memfd needs --unix-socket (file descriptors only pass over AF_UNIX)" << std::endl;
+        return 1;
+    }
+    
     std::cout << "SystemC-QEMU Bridge Test Client" << std::endl;
-    std::cout << "Server: " << host << ":" << port << std::endl;
+    std::cout << "Server: " << (unix_socket.empty() ? host + ":" + std::to_string(port) : unix_socket) << std::endl;
     std::cout << "Test:   " << test_type << std::endl;
     std::cout << std::endl;
     
     try {
         SystemCTestClient client(host, port);
+        client.set_shm(use_shm);
+        client.set_batch_size(batch_size);
+        client.set_pipeline_depth(pipeline_depth);
+        client.set_unix_socket(unix_socket);
         
         if (!client.connect()) {
             return 1;
         }
+        if (use_memfd && !client.attach_guest_ram(GUEST_RAM_SIZE)) {
+            return 1;
+        }
         
         bool success = false;
         if (test_type == "basic") {
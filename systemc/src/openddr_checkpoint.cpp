@@ -0,0 +1,203 @@
+// Checkpoint file writer and reader (see openddr_checkpoint.h)
+#include "openddr_checkpoint.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace OpenDDRCheckpoint {
+
+static const uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+// FNV-1a taken a 64-bit word at a time (bytes for the tail), so checking a
+// large memory image costs about as much as reading it
+uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        hash = (hash ^ word) * FNV_PRIME;
+        p += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        hash = (hash ^ *p++) * FNV_PRIME;
+        size--;
+    }
+    return hash;
+}
+
+static uint64_t align_up(uint64_t value) {
+    return (value + SECTION_ALIGN - 1) & ~(SECTION_ALIGN - 1);
+}
+
+Writer::Writer(const char* model_name) : model(model_name) {}
+
+void Writer::begin_section(uint32_t id, uint32_t record_size) {
+    Section section;
+    memset(&section.entry, 0, sizeof(section.entry));
+    section.entry.id = id;
+    section.entry.record_size = record_size;
+    sections.push_back(section);
+}
+
+void Writer::append(const void* data, size_t size) {
+    if (size > 0) {
+        sections.back().chunks.push_back({data, size});
+        sections.back().entry.size += size;
+    }
+}
+
+void Writer::append_copy(const void* data, size_t size) {
+    copies.emplace_back(static_cast<const char*>(data), size);
+    append(copies.back().data(), size);
+}
+
+bool Writer::write(const std::string& path, std::string& error) {
+    // Lay out the sections after the header and section table
+    uint64_t offset = align_up(sizeof(FileHeader) + sections.size() * sizeof(SectionEntry));
+    uint64_t checksum = FNV_OFFSET;
+    std::vector<SectionEntry> table;
+    for (Section& section : sections) {
+        section.entry.offset = offset;
+        offset = align_up(offset + section.entry.size);
+        for (const Chunk& chunk : section.chunks) {
+            checksum = fnv1a(checksum, chunk.data, chunk.size);
+        }
+        table.push_back(section.entry);
+    }
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+    header.version = FILE_VERSION;
+    header.section_count = static_cast<uint32_t>(sections.size());
+    header.file_size = offset;
+    header.checksum = checksum;
+    strncpy(header.model, model.c_str(), sizeof(header.model) - 1);
+
+    // Write to a temporary name so a failed save never replaces a good file
+    std::string tmp_path = path + ".tmp";
+    FILE* fp = fopen(tmp_path.c_str(), "wb");
+    if (fp == nullptr) {
+        error = "cannot create " + tmp_path + ": " + strerror(errno);
+        return false;
+    }
+
+    static const char padding[SECTION_ALIGN] = {};
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+              (table.empty() || fwrite(table.data(), sizeof(SectionEntry), table.size(), fp) == table.size());
+    uint64_t written = sizeof(header) + table.size() * sizeof(SectionEntry);
+    for (const Section& section : sections) {
+        if (!ok) {
+            break;
+        }
+        ok = fwrite(padding, 1, section.entry.offset - written, fp) == section.entry.offset - written;
+        written = section.entry.offset;
+        for (const Chunk& chunk : section.chunks) {
+            ok = ok && fwrite(chunk.data, 1, chunk.size, fp) == chunk.size;
+        }
+        written += section.entry.size;
+    }
+    ok = ok && fwrite(padding, 1, header.file_size - written, fp) == header.file_size - written;
+    ok = (fclose(fp) == 0) && ok;
+
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        error = "cannot write " + path + ": " + strerror(errno);
+        unlink(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+Reader::~Reader() {
+    if (base != nullptr) {
+        munmap(const_cast<uint8_t*>(base), length);
+    }
+}
+
+bool Reader::open(const std::string& path, const char* model_name, std::string& error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(FileHeader)) {
+        error = path + " is not an OpenDDR checkpoint";
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        error = "cannot map " + path + ": " + strerror(errno);
+        return false;
+    }
+    base = static_cast<const uint8_t*>(map);
+    length = st.st_size;
+    madvise(map, length, MADV_SEQUENTIAL);
+
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(base);
+    const SectionEntry* table = reinterpret_cast<const SectionEntry*>(base + sizeof(FileHeader));
+    if (memcmp(header->magic, FILE_MAGIC, sizeof(header->magic)) != 0) {
+        error = path + " is not an OpenDDR checkpoint";
+    } else if (header->version != FILE_VERSION) {
+        error = path + ": checkpoint version " + std::to_string(header->version) +
+                ", expected " + std::to_string(FILE_VERSION);
+    } else if (header->file_size != length ||
+               sizeof(FileHeader) + header->section_count * sizeof(SectionEntry) > length) {
+        error = path + ": checkpoint is truncated";
+    } else if (strncmp(header->model, model_name, sizeof(header->model)) != 0) {
+        error = path + ": checkpoint was saved by \"" + std::string(header->model, strnlen(header->model, sizeof(header->model))) +
+                "\", not \"" + model_name + "\"";
+    } else {
+        uint64_t checksum = FNV_OFFSET;
+        for (uint32_t i = 0; i < header->section_count && error.empty(); i++) {
+            const SectionEntry& e = table[i];
+            if (e.offset % SECTION_ALIGN != 0 || e.offset > length || e.size > length - e.offset ||
+                (e.record_size != 0 && e.size % e.record_size != 0)) {
+                error = path + ": corrupt section table";
+            } else {
+                checksum = fnv1a(checksum, base + e.offset, e.size);
+            }
+        }
+        if (error.empty() && checksum != header->checksum) {
+            error = path + ": checksum mismatch";
+        }
+    }
+
+    if (!error.empty()) {
+        munmap(map, length);
+        base = nullptr;
+        length = 0;
+        return false;
+    }
+    madvise(map, length, MADV_NORMAL);
+    return true;
+}
+
+const void* Reader::section(uint32_t id, uint32_t record_size, size_t& count) const {
+    count = 0;
+    if (base == nullptr) {
+        return nullptr;
+    }
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(base);
+    const SectionEntry* table = reinterpret_cast<const SectionEntry*>(base + sizeof(FileHeader));
+    for (uint32_t i = 0; i < header->section_count; i++) {
+        if (table[i].id == id) {
+            if (table[i].record_size != record_size) {
+                return nullptr;
+            }
+            count = table[i].size / record_size;
+            return base + table[i].offset;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace OpenDDRCheckpoint
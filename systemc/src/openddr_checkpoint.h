@@ -0,0 +1,165 @@
+#ifndef OPENDDR_CHECKPOINT_H
+#define OPENDDR_CHECKPOINT_H
+
+// Binary checkpoints of the complete OpenDDRController state.
+//
+// A checkpoint is a FileHeader, a table of SectionEntry and the sections
+// themselves.  Every section is an array of fixed-size, trivially copyable
+// records starting on a 64-byte boundary, so a reader can mmap the file and
+// use the records in place; Reader does exactly that.  Integers are stored
+// in host byte order.
+//
+// FILE_VERSION is bumped whenever a record layout changes; readers reject
+// other versions instead of guessing.  Sections a reader does not know are
+// skipped, so new sections may be added without a version bump.
+//
+// This header and openddr_checkpoint.cpp do not depend on SystemC; the
+// controller side is OpenDDRController::save_checkpoint/restore_checkpoint.
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace OpenDDRCheckpoint {
+
+static constexpr char FILE_MAGIC[8] = "ODDRCKP";
+static constexpr uint32_t FILE_VERSION = 1;
+static constexpr uint64_t SECTION_ALIGN = 64;
+
+enum SectionId : uint32_t {
+    SEC_CONTROLLER = 1,        // one ControllerState
+    SEC_WRITE_ADDR_QUEUE,      // AXITransaction, front first
+    SEC_WRITE_DATA_QUEUE,
+    SEC_WRITE_RESP_QUEUE,
+    SEC_READ_ADDR_QUEUE,
+    SEC_READ_RESP_QUEUE,
+    SEC_DDR_CMD_QUEUE,         // DDRCommand, front first
+    SEC_PAYLOAD_POOL,          // DDRPayload, one per pool slot
+    SEC_PAYLOAD_FREE_LIST,     // uint16_t handles
+    SEC_MEMORY_BLOCKS,         // uint64_t block address + block bytes
+    SEC_RNG,                   // std::mt19937 state as text
+    SEC_STATS                  // one StatsState
+};
+
+struct FileHeader {
+    char magic[8];           // "ODDRCKP"
+    uint32_t version;
+    uint32_t section_count;
+    uint64_t file_size;
+    uint64_t checksum;       // FNV-1a over the section contents, in table order
+    char model[64];          // Policy::name() of the saving model
+};
+static_assert(sizeof(FileHeader) == 96, "checkpoint header layout changed");
+
+struct SectionEntry {
+    uint32_t id;
+    uint32_t record_size;
+    uint64_t offset;         // From the start of the file, SECTION_ALIGN aligned
+    uint64_t size;           // Bytes, a multiple of record_size
+};
+static_assert(sizeof(SectionEntry) == 24, "checkpoint section entry layout changed");
+
+static constexpr int BANKS = 16;
+static constexpr int REGISTERS = 20;     // APB 0x000..0x04C
+static constexpr int COUNTERS = 8;       // APB 0x100..0x11C
+
+// Scalar controller state.  Times are mck cycles, except refresh, which is
+// kept as the time left until the next refresh is due.
+struct ControllerState {
+    uint64_t cycle;                      // Model cycle at the checkpoint
+    uint64_t seq_ready_cycle;
+    uint64_t next_stats_cycle;
+    uint64_t refresh_remaining_ps;       // ps until due, plus 1; 0: not armed
+    uint64_t bank_last_activate[BANKS];
+    uint64_t bank_last_precharge[BANKS];
+    uint32_t registers[REGISTERS];
+    uint32_t counters[COUNTERS];
+    uint16_t page_table_row[BANKS];
+    uint8_t page_table_valid[BANKS];
+    uint16_t active_write_payload;
+    uint8_t seq_state;
+    uint8_t apb_state;
+    uint8_t current_pattern;
+    uint8_t refresh_pending_counter;
+    uint16_t flags;                      // FLAG_* below
+};
+
+// Statistics beyond the APB counters in ControllerState.  Checkpoints
+// written before this section existed restore them as zero.
+struct StatsState {
+    uint64_t page_conflicts;
+    uint64_t bank_accesses[BANKS];       // Column accesses per bank
+};
+
+enum ControllerFlag : uint16_t {
+    FLAG_DDR_INIT_DONE         = 1 << 0,
+    FLAG_BUFACC_CYCLE_EN       = 1 << 1,
+    FLAG_BUFACC_CYCLE_MODE_WR  = 1 << 2,
+    FLAG_LAST_WAS_WRITE        = 1 << 3,
+    FLAG_QUEUE_OVERFLOW_ACTIVE = 1 << 4,
+    FLAG_AXI_AW_READY          = 1 << 5,
+    FLAG_AXI_W_READY           = 1 << 6,
+    FLAG_AXI_B_VALID           = 1 << 7,
+    FLAG_AXI_AR_READY          = 1 << 8,
+    FLAG_AXI_R_VALID           = 1 << 9
+};
+
+// Builds a checkpoint from borrowed or copied chunks and writes it in one
+// pass.  Borrowed chunks must stay valid until write() returns.
+class Writer {
+public:
+    explicit Writer(const char* model_name);
+
+    void begin_section(uint32_t id, uint32_t record_size);
+    void append(const void* data, size_t size);       // Borrowed
+    void append_copy(const void* data, size_t size);  // Copied now
+
+    bool write(const std::string& path, std::string& error);
+
+private:
+    struct Chunk {
+        const void* data;
+        size_t size;
+    };
+    struct Section {
+        SectionEntry entry;
+        std::vector<Chunk> chunks;
+    };
+
+    std::string model;
+    std::vector<Section> sections;
+    std::deque<std::string> copies;
+};
+
+// Maps a checkpoint read-only and hands out its sections in place
+class Reader {
+public:
+    Reader() = default;
+    ~Reader();
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    // Validates magic, version, size, checksum and the saving model's name
+    bool open(const std::string& path, const char* model_name, std::string& error);
+
+    // Records of a section, or nullptr (count 0) if it is absent or its
+    // record size differs from record_size
+    const void* section(uint32_t id, uint32_t record_size, size_t& count) const;
+
+    template <typename T>
+    const T* records(uint32_t id, size_t& count) const {
+        return static_cast<const T*>(section(id, sizeof(T), count));
+    }
+
+private:
+    const uint8_t* base = nullptr;
+    size_t length = 0;
+};
+
+uint64_t fnv1a(uint64_t hash, const void* data, size_t size);
+
+} // namespace OpenDDRCheckpoint
+
+#endif // OPENDDR_CHECKPOINT_H
@@ -0,0 +1,534 @@
+#ifndef OPENDDR_CONTROLLER_H
+#define OPENDDR_CONTROLLER_H
+
+// OpenDDR DDR memory controller core shared by every model variant.
+//
+// OpenDDRController<Policy> is the single implementation of the AXI, APB,
+// scheduler, sequencer, DFI and refresh logic; Policy selects the variant's
+// scheduler, timing, verification, logging, backing store and address map
+// at compile time (see openddr_controller_policies.h).  The variants are
+// typedefs in openddr_systemc_model.h, openddr_systemc_model_enhanced.h and
+// openddr_systemc_model_verification_disabled.h; member definitions live in
+// openddr_controller_impl.h and are instantiated once per variant in the
+// matching .cpp file.
+
+#ifndef SC_INCLUDE_DYNAMIC_PROCESSES
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#endif
+#include <systemc.h>
+#include <vector>
+#include <map>
+#include <random>
+#include <string>
+#include "openddr_transaction.h"
+#include "openddr_ring_buffer.h"
+#include "openddr_model_config.h"
+#include "openddr_model_stats.h"
+#include "openddr_checkpoint.h"
+#include "openddr_seed.h"
+#include "openddr_dfi_data.h"
+#include "openddr_controller_policies.h"
+
+// Address field widths
+static const int ROW_WIDTH = 16;
+static const int BUF_ADR_WIDTH = 7;
+static const int COL_WIDTH = 10;
+
+template <class Policy>
+class OpenDDRController : public sc_module {
+public:
+    typedef typename Policy::Scheduler Scheduler;
+    typedef typename Policy::Timing Timing;
+    typedef typename Policy::Verification Verification;
+    typedef typename Policy::Logging Logging;
+    typedef typename Policy::Store Store;
+    typedef typename Policy::AddressMap AddressMap;
+
+    // Clock and Reset
+    sc_in<bool> mck;
+    sc_in<bool> mc_rst_b;
+    sc_in<bool> porst_b;
+    sc_in<bool> slow_clk;
+
+    // AXI Port 0 Interface
+    sc_in<bool> mc0_aclk;
+    sc_in<bool> mc0_aresetn;
+    
+    // AXI Write Address Channel
+    sc_in<sc_uint<12>> mc0_axi_awid;
+    sc_in<sc_uint<40>> mc0_axi_awaddr;
+    sc_in<sc_uint<8>> mc0_axi_awlen;
+    sc_in<sc_uint<3>> mc0_axi_awsize;
+    sc_in<sc_uint<2>> mc0_axi_awburst;
+    sc_in<bool> mc0_axi_awlock;
+    sc_in<sc_uint<4>> mc0_axi_awcache;
+    sc_in<sc_uint<3>> mc0_axi_awprot;
+    sc_in<sc_uint<4>> mc0_axi_awqos;
+    sc_in<bool> mc0_axi_awvalid;
+    sc_out<bool> mc0_axi_awready;
+
+    // AXI Write Data Channel
+    sc_in<sc_uint<64>> mc0_axi_wdata;
+    sc_in<sc_uint<8>> mc0_axi_wstrb;
+    sc_in<bool> mc0_axi_wlast;
+    sc_in<bool> mc0_axi_wvalid;
+    sc_out<bool> mc0_axi_wready;
+
+    // AXI Write Response Channel
+    sc_out<sc_uint<12>> mc0_axi_bid;
+    sc_out<sc_uint<2>> mc0_axi_bresp;
+    sc_out<bool> mc0_axi_bvalid;
+    sc_in<bool> mc0_axi_bready;
+
+    // AXI Read Address Channel
+    sc_in<sc_uint<12>> mc0_axi_arid;
+    sc_in<sc_uint<40>> mc0_axi_araddr;
+    sc_in<sc_uint<8>> mc0_axi_arlen;
+    sc_in<sc_uint<3>> mc0_axi_arsize;
+    sc_in<sc_uint<2>> mc0_axi_arburst;
+    sc_in<bool> mc0_axi_arlock;
+    sc_in<sc_uint<4>> mc0_axi_arcache;
+    sc_in<sc_uint<3>> mc0_axi_arprot;
+    sc_in<sc_uint<4>> mc0_axi_arqos;
+    sc_in<bool> mc0_axi_arvalid;
+    sc_out<bool> mc0_axi_arready;
+
+    // AXI Read Data Channel
+    sc_out<sc_uint<12>> mc0_axi_rid;
+    sc_out<sc_uint<64>> mc0_axi_rdata;
+    sc_out<sc_uint<2>> mc0_axi_rresp;
+    sc_out<bool> mc0_axi_rlast;
+    sc_out<bool> mc0_axi_rvalid;
+    sc_in<bool> mc0_axi_rready;
+
+    // APB Interface
+    sc_in<bool> mc_penable;
+    sc_in<bool> mc_psel;
+    sc_in<bool> mc_pwr;
+    sc_in<sc_uint<10>> mc_paddr;
+    sc_in<sc_uint<32>> mc_pwdata;
+    sc_out<sc_uint<32>> mc_prdata;
+    sc_out<bool> mc_pready;
+    sc_out<bool> mc_pslverr;
+
+    // DFI Command Interface (DDR)
+    sc_out<sc_uint<2>> dfi_dram_clk_disable_0;
+    sc_out<sc_uint<2>> dfi_dram_clk_disable_1;
+    sc_out<bool> dfi_dram_ca_disable;
+    sc_out<sc_uint<2>> dfi_cs_0_p0;
+    sc_out<sc_uint<2>> dfi_cs_0_p1;
+    sc_out<sc_uint<2>> dfi_cs_1_p2;
+    sc_out<sc_uint<2>> dfi_cs_1_p3;
+    sc_out<sc_uint<7>> dfi_address_0_p0;
+    sc_out<sc_uint<7>> dfi_address_0_p1;
+    sc_out<sc_uint<7>> dfi_address_1_p2;
+    sc_out<sc_uint<7>> dfi_address_1_p3;
+    sc_out<bool> dfi_reset_n;
+
+    // DFI WCK Control Interface
+    sc_out<sc_uint<4>> dfi_wck_cs;
+    sc_out<sc_uint<4>> dfi_wck_en;
+    sc_out<sc_uint<2>> dfi_wck_toggle;
+
+    // DFI Write Data Interface (DDRx - 16 phases; per-phase sc_vector, or one
+    // packed bus with OPENDDR_DFI_PACKED - see openddr_dfi_data.h)
+    DFIDataOut<32> dfi_wrdata;
+
+    // DFI Write Data Mask
+    DFIDataOut<4> dfi_wrdata_mask;
+
+    // DFI Write Data Enable
+    DFIDataOut<4> dfi_wrdata_en;
+
+    // DFI Read Data Interface
+    sc_out<bool> mc_rdrst_b;
+    sc_out<bool> mc_rcv_en;
+    sc_out<bool> dfi_rddata_en;
+    sc_in<bool> dfi_rddata_valid;
+
+    DFIDataIn<32> dfi_rddata;
+
+    // Configuration registers
+    sc_uint<32> seq_control_reg;
+    sc_uint<32> buf_config_reg;
+    sc_uint<32> ddr_config_reg;
+    sc_uint<32> ddr_adr_config_reg;
+    sc_uint<32> pmu_cmd_reg;
+    sc_uint<32> pmu_mrs_reg;
+    sc_uint<32> pmu_mpc_reg;
+    sc_uint<32> pmu_status_reg;
+    sc_uint<32> ac_timing_reg1;
+    sc_uint<32> ac_timing_reg2;
+    sc_uint<32> ac_timing_reg3;
+    sc_uint<32> ac_timing_reg4;
+    sc_uint<32> ac_timing_reg5;
+    sc_uint<32> ac_timing_reg6;
+    sc_uint<32> ac_timing_reg7;
+    sc_uint<32> ac_timing_reg8;
+    sc_uint<32> ac_timing_reg9;
+    sc_uint<32> ac_timing_reg10;
+    sc_uint<32> refresh_cntrl_reg;
+    sc_uint<32> test_config_reg;
+
+    // Internal state variables
+    enum SequencerState {
+        SEQ_IDLE = 0,
+        SEQ_W_ACT = 1,
+        SEQ_W_WR = 2,
+        SEQ_W_RD = 3,
+        SEQ_W_PRE = 4,
+        SEQ_W_REF = 5,
+        SEQ_W_MRS = 6,
+        SEQ_W_SLFR = 7
+    };
+
+    SequencerState seq_state;
+    bool ddr_init_done;
+    bool bufacc_cycle_en;
+    bool bufacc_cycle_mode_wr;
+
+    // Backing store for AXI data (Store policy)
+    Store memory_store;
+    
+    // Data pattern generators for verification
+    enum DataPattern {
+        PATTERN_INCREMENTAL,
+        PATTERN_WALKING_ONES,
+        PATTERN_WALKING_ZEROS,
+        PATTERN_CHECKERBOARD,
+        PATTERN_RANDOM,
+        PATTERN_ADDRESS_BASED,
+        PATTERN_CUSTOM
+    };
+
+    // Buffer structures
+    static const int BUF_DEPTH = 128;
+    static const int WRBUF_DATA_WIDTH = 256;
+    static const int RDBUF_DATA_WIDTH = 256;
+    static const int CMD_WIDTH = 59;
+
+    // Write buffer
+    std::vector<bool> wbuf_cmd_vld_memory;
+    std::vector<sc_uint<CMD_WIDTH>> wbuf_cmd_memory;
+    std::vector<sc_biguint<WRBUF_DATA_WIDTH>> wbuf_data_memory;
+    std::vector<sc_uint<WRBUF_DATA_WIDTH/8>> wbuf_data_vld_memory;
+
+    // Read buffer
+    std::vector<bool> rbuf_cmd_vld_memory;
+    std::vector<sc_uint<CMD_WIDTH>> rbuf_cmd_memory;
+    std::vector<sc_biguint<RDBUF_DATA_WIDTH>> rbuf_data_memory;
+    std::vector<bool> rbuf_data_vld_memory;
+
+    // Page table for open page policy
+    static const int PAGE_TABLE_DEPTH = 16;
+    std::vector<bool> page_table_vld_memory;
+    std::vector<sc_uint<ROW_WIDTH>> page_table_row_memory;
+
+    // AXI transaction queues
+    RingBuffer<AXITransaction> write_addr_queue;
+    RingBuffer<AXITransaction> write_data_queue;
+    RingBuffer<AXITransaction> write_resp_queue;
+    RingBuffer<AXITransaction> read_addr_queue;
+    RingBuffer<AXITransaction> read_resp_queue;
+
+    // DDR command queue
+    RingBuffer<DDRCommand> ddr_cmd_queue;
+
+    // Last values driven on the DFI write data buses
+    DFIWriteBeat dfi_wr_shadow;
+
+    // Write payloads referenced by DDRCommand::payload
+    DDRPayloadPool payload_pool;
+    uint16_t active_write_payload;
+
+    // mck period, taken from the bound clock at elaboration; descriptors
+    // carry cycle counts derived from it instead of sc_time
+    sc_time mck_period;
+    // cycle_base continues the cycle count of a restored checkpoint
+    uint64_t cycle_base;
+    uint64_t now_cycle() const { return cycle_base + sc_time_stamp().value() / mck_period.value(); }
+
+    // Sequencer wait state ends at this absolute mck cycle; the sequencer
+    // sleeps until then instead of counting clocks
+    uint64_t seq_ready_cycle;
+    uint64_t next_stats_cycle;
+
+    // Idle fast-forward: while nothing is queued or in flight and no AXI/APB
+    // request is presented, the mck processes sleep on idle_wake instead of
+    // running every clock.  work_event covers work created internally
+    // (refresh), the rest are the request inputs and reset.
+    sc_event work_event;
+    sc_event_or_list idle_wake;
+
+    // Refresh timer: wakes once per interval at refresh_due
+    static const uint32_t REFRESH_INTERVAL = 1950; // slow_clk cycles
+    sc_time slow_clk_period;
+    sc_time refresh_due;
+
+    // Scheduler read/write alternation
+    bool last_was_write;
+
+    // Timing counters
+    sc_uint<8> refresh_pending_counter;
+    std::map<int, sc_uint<16>> bank_timers; // For tRAS, tRP, etc.
+
+    // mck cycle of each bank's last ACT/PRE (only tracked with Timing::checks)
+    uint64_t bank_last_activate[PAGE_TABLE_DEPTH];
+    uint64_t bank_last_precharge[PAGE_TABLE_DEPTH];
+
+    // Column accesses per bank, for utilization statistics
+    uint64_t bank_accesses[PAGE_TABLE_DEPTH];
+
+    // Statistics and verification
+    sc_uint<32> total_write_transactions;
+    sc_uint<32> total_read_transactions;
+    sc_uint<32> total_ddr_commands;
+    sc_uint<32> page_hits;
+    sc_uint<32> page_misses;
+    sc_uint<32> page_conflicts;             // Misses that found another row open
+    sc_uint<32> data_errors;
+    sc_uint<32> address_errors;
+    sc_uint<32> timing_violations;
+
+    // Verification and monitoring
+    bool queue_overflow_active;
+    DataPattern current_pattern;
+    std::mt19937 random_generator;
+
+    // APB state machine
+    enum APBState {
+        APB_IDLE,
+        APB_SETUP,
+        APB_ACCESS
+    };
+    APBState apb_state;
+
+    // AXI state machines
+    bool axi_aw_ready_reg;
+    bool axi_w_ready_reg;
+    bool axi_b_valid_reg;
+    bool axi_ar_ready_reg;
+    bool axi_r_valid_reg;
+
+    // Constructor
+    SC_HAS_PROCESS(OpenDDRController);
+    explicit OpenDDRController(sc_module_name name, const ModelConfig& cfg = Policy::default_config()) :
+        sc_module(name),
+        dfi_wrdata("dfi_wrdata"),
+        dfi_wrdata_mask("dfi_wrdata_mask"),
+        dfi_wrdata_en("dfi_wrdata_en"),
+        dfi_rddata("dfi_rddata"),
+        wbuf_cmd_vld_memory(BUF_DEPTH, false),
+        wbuf_cmd_memory(BUF_DEPTH, 0),
+        wbuf_data_memory(BUF_DEPTH, 0),
+        wbuf_data_vld_memory(BUF_DEPTH, 0),
+        rbuf_cmd_vld_memory(BUF_DEPTH, false),
+        rbuf_cmd_memory(BUF_DEPTH, 0),
+        rbuf_data_memory(BUF_DEPTH, 0),
+        rbuf_data_vld_memory(BUF_DEPTH, false),
+        page_table_vld_memory(PAGE_TABLE_DEPTH, false),
+        page_table_row_memory(PAGE_TABLE_DEPTH, 0),
+        write_addr_queue(cfg.write_addr_queue_depth),
+        write_data_queue(cfg.write_data_queue_depth),
+        write_resp_queue(cfg.write_resp_queue_depth),
+        read_addr_queue(cfg.read_addr_queue_depth),
+        read_resp_queue(cfg.read_resp_queue_depth),
+        ddr_cmd_queue(cfg.ddr_cmd_queue_depth),
+        payload_pool(cfg.ddr_cmd_queue_depth + 1),
+        active_write_payload(DDRCommand::NO_PAYLOAD),
+        mck_period(5, SC_NS),
+        cycle_base(0),
+        seq_ready_cycle(0),
+        next_stats_cycle(0),
+        slow_clk_period(40, SC_NS),
+        refresh_due(SC_ZERO_TIME),
+        last_was_write(false),
+        random_generator(OpenDDRSeed::rng(this->name()))
+    {
+        // Initialize state
+        seq_state = SEQ_IDLE;
+        apb_state = APB_IDLE;
+        ddr_init_done = false;
+        bufacc_cycle_en = false;
+        bufacc_cycle_mode_wr = false;
+        refresh_pending_counter = 0;
+        total_write_transactions = 0;
+        total_read_transactions = 0;
+        total_ddr_commands = 0;
+        page_hits = 0;
+        page_misses = 0;
+        page_conflicts = 0;
+        data_errors = 0;
+        address_errors = 0;
+        timing_violations = 0;
+        for (int i = 0; i < PAGE_TABLE_DEPTH; i++) {
+            bank_last_activate[i] = 0;
+            bank_last_precharge[i] = 0;
+            bank_accesses[i] = 0;
+        }
+
+        // Initialize AXI state
+        axi_aw_ready_reg = false;
+        axi_w_ready_reg = false;
+        axi_b_valid_reg = false;
+        axi_ar_ready_reg = false;
+        axi_r_valid_reg = false;
+
+        queue_overflow_active = false;
+        current_pattern = PATTERN_ADDRESS_BASED;
+
+        // Initialize configuration registers with realistic DDR values
+        seq_control_reg = 0x00000001; // DDR init done
+        buf_config_reg = 0x00000080; // Buffer configuration
+        ddr_config_reg = 0x00030520; // DDR, 64-bit data width, BL32
+        ddr_adr_config_reg = 0x00000123; // Optimized address mapping
+        pmu_cmd_reg = 0x00000000;
+        pmu_mrs_reg = 0x00000000;
+        pmu_mpc_reg = 0x00000000;
+        pmu_status_reg = 0x00000030; // SEQ TYPE = DDRx
+        refresh_cntrl_reg = 0x00001F41; // Enable refresh, tREF = 7.8us
+        test_config_reg = 0x00000001; // Enable performance counters
+
+        // Set realistic DDR timing registers
+        ac_timing_reg1 = 0x120E1215; // tCL=18, tWL=14, tRCD=18, tRP=21
+        ac_timing_reg2 = 0x2A3F1008; // tRAS=42, tRC=63, tRRD=16, tFAW=8
+        ac_timing_reg3 = 0x08040820; // tWTR=8, tRTP=4, tCCD=8, tBL=32
+        ac_timing_reg4 = 0x1E780118; // tREFI=7800, tRFC=280, tXSR=280
+        ac_timing_reg5 = 0x0A050A05; // tMRD=10, tMOD=5, tZQCS=10, tZQCL=5
+        ac_timing_reg6 = 0x03020304; // tCKE=3, tCKESR=2, tXP=3, tXPDLL=4
+        ac_timing_reg7 = 0x02010203; // tODTon=2, tODToff=1, tAON=2, tAOF=3
+        ac_timing_reg8 = 0x04020108; // tDQSCK=4, tWCKPRE=2, tWCKDQO=1, tWCKDQI=8
+        ac_timing_reg9 = 0x02010405; // tRPRE=2, tWPRE=1, tMRR=4, tMRW=5
+        ac_timing_reg10 = 0x0A050C06; // tVREF=10, tFCDLR=5, tOSCO=12, tCMDCKE=6
+
+        // Register processes
+        SC_METHOD(axi_write_addr_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(axi_write_data_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(axi_write_resp_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(axi_read_addr_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(axi_read_data_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(apb_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(scheduler_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(sequencer_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(dfi_command_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(dfi_write_data_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(dfi_read_data_process);
+        sensitive << mck.pos();
+        dont_initialize();
+
+        SC_METHOD(refresh_timer_process);
+        sensitive << slow_clk.pos();
+        dont_initialize();
+
+        if (Verification::enabled) {
+            SC_METHOD(verification_process);
+            sensitive << mck.pos();
+            dont_initialize();
+        }
+    }
+
+    void end_of_elaboration() override {
+        if (sc_clock* clk = dynamic_cast<sc_clock*>(mck.get_interface())) {
+            mck_period = clk->period();
+        }
+        if (sc_clock* clk = dynamic_cast<sc_clock*>(slow_clk.get_interface())) {
+            slow_clk_period = clk->period();
+        }
+
+        idle_wake |= mc_rst_b.value_changed_event();
+        idle_wake |= mc0_axi_awvalid.value_changed_event();
+        idle_wake |= mc0_axi_wvalid.value_changed_event();
+        idle_wake |= mc0_axi_arvalid.value_changed_event();
+        idle_wake |= mc_psel.value_changed_event();
+        idle_wake |= work_event;
+    }
+
+    // Process declarations
+    void axi_write_addr_process();
+    void axi_write_data_process();
+    void axi_write_resp_process();
+    void axi_read_addr_process();
+    void axi_read_data_process();
+    void apb_process();
+    void scheduler_process();
+    void sequencer_process();
+    void dfi_command_process();
+    void dfi_write_data_process();
+    void dfi_read_data_process();
+    void refresh_timer_process();
+    void verification_process();
+
+    // Helper functions
+    void reset_model();
+    void seq_wait(uint32_t cycles);
+    bool seq_wait_done();
+    bool model_idle() const;
+    bool off_clock_edge() const;
+    void sleep_while_idle();
+    void update_page_table(int bank, sc_uint<ROW_WIDTH> row, bool open);
+    bool check_page_hit(int bank, sc_uint<ROW_WIDTH> row);
+    bool count_page_access(int bank, sc_uint<ROW_WIDTH> row);
+    bool schedule_ddr_command(DDRCommand cmd);
+    void execute_ddr_command(const DDRCommand& cmd);
+    sc_uint<32> read_register(sc_uint<10> addr) const;
+    void write_register(sc_uint<10> addr, sc_uint<32> data);
+    void decode_address(sc_uint<40> addr, int& rank, int& bank, sc_uint<ROW_WIDTH>& row, sc_uint<COL_WIDTH>& col);
+    void print_statistics();
+    void print_queue_high_water();
+    ModelStatistics statistics() const;
+
+    // Checkpoint/restore of the complete controller state (openddr_checkpoint.h).
+    // Restore into a model built with the same policy and ModelConfig, before
+    // sc_start() or while the simulation is paused; the model's cycle count
+    // continues from the checkpoint.
+    bool save_checkpoint(const std::string& path, std::string& error);
+    bool restore_checkpoint(const std::string& path, std::string& error);
+
+    // Verification functions
+    sc_uint<64> generate_data_pattern(sc_uint<40> addr, DataPattern pattern);
+    bool verify_data_pattern(sc_uint<40> addr, sc_uint<64> data, DataPattern pattern);
+    void write_memory_block(sc_uint<40> addr, sc_uint<64> data, sc_uint<8> strb);
+    sc_uint<64> read_memory_block(sc_uint<40> addr);
+    void update_bank_timing(int bank, const DDRCommand& cmd);
+    void log_verification_error(const std::string& error_type, sc_uint<40> addr, const std::string& details);
+
+    // Test pattern generators
+    void run_address_test();
+    void run_data_pattern_test();
+    void run_burst_test();
+    void run_bank_interleaving_test();
+    void run_refresh_test();
+    void run_timing_test();
+};
+
+#endif // OPENDDR_CONTROLLER_H
@@ -0,0 +1,1404 @@
+#ifndef OPENDDR_CONTROLLER_IMPL_H
+#define OPENDDR_CONTROLLER_IMPL_H
+
+// Member definitions of OpenDDRController.  Only the variant .cpp files
+// include this header, each followed by one explicit instantiation; everyone
+// else includes the variant header, which declares it extern.
+
+#include "openddr_controller.h"
+#include "openddr_log.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstring>
+#include <type_traits>
+
+// OPENDDR_LOG limited to the Logging policy's max_level
+#define OPENDDR_MODEL_LOG(ev, ...) \
+    do { \
+        if constexpr (OpenDDRLog::EVENT_TABLE[OpenDDRLog::EV_##ev].level <= Logging::max_level) { \
+            OPENDDR_LOG(ev, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+// AXI Write Address Channel Process
+template <class Policy>
+void OpenDDRController<Policy>::axi_write_addr_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        axi_aw_ready_reg = false;
+        mc0_axi_awready.write(false);
+        // Clear write address queue
+        write_addr_queue.clear();
+        return;
+    }
+
+    // Handle AXI write address channel with proper state machine
+    if (mc0_axi_awvalid.read() && !axi_aw_ready_reg) {
+        // Check if we can accept the transaction
+        if (!write_addr_queue.full()) {
+            AXITransaction trans;
+            trans.id = mc0_axi_awid.read();
+            trans.addr = mc0_axi_awaddr.read();
+            trans.len = mc0_axi_awlen.read();
+            trans.size = mc0_axi_awsize.read();
+            trans.burst = mc0_axi_awburst.read();
+            trans.is_write = true;
+            trans.issue_cycle = now_cycle();
+            
+            // Always accept all transactions
+            trans.resp = 0; // OKAY - always accept transactions
+            
+            write_addr_queue.push(trans);
+            axi_aw_ready_reg = true;
+            total_write_transactions++;
+            
+            OPENDDR_MODEL_LOG(AXI_WRITE_ADDR, trans.id, trans.addr, trans.len, trans.size);
+        }
+    } else {
+        axi_aw_ready_reg = false;
+    }
+    
+    mc0_axi_awready.write(axi_aw_ready_reg);
+
+    sleep_while_idle();
+}
+
+// AXI Write Data Channel Process
+template <class Policy>
+void OpenDDRController<Policy>::axi_write_data_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        axi_w_ready_reg = false;
+        mc0_axi_wready.write(false);
+        write_data_queue.clear();
+        return;
+    }
+
+    // Handle AXI write data channel
+    if (mc0_axi_wvalid.read() && !axi_w_ready_reg) {
+        if (!write_data_queue.full()) {
+            AXITransaction trans;
+            trans.data = mc0_axi_wdata.read();
+            trans.strb = mc0_axi_wstrb.read();
+            trans.last = mc0_axi_wlast.read();
+            trans.is_write = true;
+            trans.issue_cycle = now_cycle();
+            
+            write_data_queue.push(trans);
+            axi_w_ready_reg = true;
+            
+            OPENDDR_MODEL_LOG(AXI_WRITE_DATA, trans.data, trans.strb, trans.last);
+        }
+    } else {
+        axi_w_ready_reg = false;
+    }
+    
+    mc0_axi_wready.write(axi_w_ready_reg);
+
+    sleep_while_idle();
+}
+
+// AXI Write Response Channel Process
+template <class Policy>
+void OpenDDRController<Policy>::axi_write_resp_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        axi_b_valid_reg = false;
+        mc0_axi_bvalid.write(false);
+        mc0_axi_bid.write(0);
+        mc0_axi_bresp.write(0);
+        write_resp_queue.clear();
+        return;
+    }
+
+    // Generate write responses
+    if (!write_resp_queue.empty() && mc0_axi_bready.read() && !axi_b_valid_reg) {
+        AXITransaction trans = write_resp_queue.front();
+        write_resp_queue.pop();
+        
+        mc0_axi_bid.write(trans.id);
+        mc0_axi_bresp.write(trans.resp);
+        axi_b_valid_reg = true;
+        
+        OPENDDR_MODEL_LOG(AXI_WRITE_RESP, trans.id, trans.resp);
+    } else if (axi_b_valid_reg && mc0_axi_bready.read()) {
+        axi_b_valid_reg = false;
+    }
+    
+    mc0_axi_bvalid.write(axi_b_valid_reg);
+
+    sleep_while_idle();
+}
+
+// AXI Read Address Channel Process
+template <class Policy>
+void OpenDDRController<Policy>::axi_read_addr_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        axi_ar_ready_reg = false;
+        mc0_axi_arready.write(false);
+        read_addr_queue.clear();
+        return;
+    }
+
+    // Handle AXI read address channel
+    if (mc0_axi_arvalid.read() && !axi_ar_ready_reg) {
+        if (!read_addr_queue.full()) {
+            AXITransaction trans;
+            trans.id = mc0_axi_arid.read();
+            trans.addr = mc0_axi_araddr.read();
+            trans.len = mc0_axi_arlen.read();
+            trans.size = mc0_axi_arsize.read();
+            trans.burst = mc0_axi_arburst.read();
+            trans.is_write = false;
+            trans.issue_cycle = now_cycle();
+            
+            // Always accept all transactions
+            trans.resp = 0; // OKAY - always accept transactions
+            
+            read_addr_queue.push(trans);
+            axi_ar_ready_reg = true;
+            total_read_transactions++;
+            
+            OPENDDR_MODEL_LOG(AXI_READ_ADDR, trans.id, trans.addr, trans.len, trans.size);
+        }
+    } else {
+        axi_ar_ready_reg = false;
+    }
+    
+    mc0_axi_arready.write(axi_ar_ready_reg);
+
+    sleep_while_idle();
+}
+
+// AXI Read Data Channel Process
+template <class Policy>
+void OpenDDRController<Policy>::axi_read_data_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        axi_r_valid_reg = false;
+        mc0_axi_rvalid.write(false);
+        mc0_axi_rid.write(0);
+        mc0_axi_rdata.write(0);
+        mc0_axi_rresp.write(0);
+        mc0_axi_rlast.write(false);
+        read_resp_queue.clear();
+        return;
+    }
+
+    // Generate read responses
+    if (!read_resp_queue.empty() && mc0_axi_rready.read() && !axi_r_valid_reg) {
+        AXITransaction trans = read_resp_queue.front();
+        read_resp_queue.pop();
+        
+        mc0_axi_rid.write(trans.id);
+        mc0_axi_rdata.write(trans.data);
+        mc0_axi_rresp.write(trans.resp);
+        mc0_axi_rlast.write(trans.last);
+        axi_r_valid_reg = true;
+        
+        OPENDDR_MODEL_LOG(AXI_READ_DATA, trans.id, trans.data, trans.last, trans.resp);
+    } else if (axi_r_valid_reg && mc0_axi_rready.read()) {
+        axi_r_valid_reg = false;
+    }
+    
+    mc0_axi_rvalid.write(axi_r_valid_reg);
+
+    sleep_while_idle();
+}
+
+// APB Register Interface Process
+template <class Policy>
+void OpenDDRController<Policy>::apb_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        mc_prdata.write(0);
+        mc_pready.write(false);
+        mc_pslverr.write(false);
+        apb_state = APB_IDLE;
+        return;
+    }
+
+    switch (apb_state) {
+        case APB_IDLE:
+            if (mc_psel.read()) {
+                apb_state = APB_SETUP;
+                mc_pready.write(false);
+            }
+            break;
+            
+        case APB_SETUP:
+            if (mc_penable.read()) {
+                apb_state = APB_ACCESS;
+                sc_uint<10> addr = mc_paddr.read();
+                
+                if (mc_pwr.read()) {
+                    // Write operation
+                    sc_uint<32> data = mc_pwdata.read();
+                    write_register(addr, data);
+                    OPENDDR_MODEL_LOG(APB_WRITE, addr, data);
+                } else {
+                    // Read operation
+                    sc_uint<32> data = read_register(addr);
+                    mc_prdata.write(data);
+                    OPENDDR_MODEL_LOG(APB_READ, addr, data);
+                }
+                
+                mc_pready.write(true);
+                mc_pslverr.write(false);
+            }
+            break;
+            
+        case APB_ACCESS:
+            if (!mc_psel.read()) {
+                apb_state = APB_IDLE;
+                mc_pready.write(false);
+            }
+            break;
+    }
+
+    sleep_while_idle();
+}
+
+// Scheduler Process - turns AXI requests into DDR commands
+template <class Policy>
+void OpenDDRController<Policy>::scheduler_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        bufacc_cycle_en = false;
+        bufacc_cycle_mode_wr = false;
+        return;
+    }
+
+    // A request is only taken when its response and worst-case commands
+    // (ACT + RD/WR) fit.
+    bool cmd_room = ddr_cmd_queue.free_slots() >= 2;
+    bool has_write_work = !write_addr_queue.empty() && !write_data_queue.empty() &&
+                          !write_resp_queue.full() && cmd_room;
+    bool has_read_work = !read_addr_queue.empty() && !read_resp_queue.full() && cmd_room;
+    
+    if (has_write_work || has_read_work) {
+        bufacc_cycle_en = true;
+        
+        // Read/write arbitration is the Scheduler policy's
+        if (Scheduler::pick_write(has_write_work, has_read_work, last_was_write)) {
+            bufacc_cycle_mode_wr = true;
+            last_was_write = true;
+            
+            // Process write transaction
+            AXITransaction addr_trans = write_addr_queue.front();
+            AXITransaction data_trans = write_data_queue.front();
+            write_addr_queue.pop();
+            write_data_queue.pop();
+            
+            // Store data in memory model
+            write_memory_block(addr_trans.addr, data_trans.data, data_trans.strb);
+            
+            // Create DDR command
+            DDRCommand ddr_cmd;
+            int rank, bank;
+            sc_uint<ROW_WIDTH> row;
+            sc_uint<COL_WIDTH> col;
+            decode_address(addr_trans.addr, rank, bank, row, col);
+            
+            ddr_cmd.original_addr = addr_trans.addr;
+            
+            // Check for page hit/miss
+            if (count_page_access(bank, row)) {
+                ddr_cmd.cmd_type = DDRCommand::CMD_WRITE;
+            } else {
+                // Need activate first, then write
+                DDRCommand act_cmd;
+                act_cmd.cmd_type = DDRCommand::CMD_ACT;
+                act_cmd.rank = rank;
+                act_cmd.bank = bank;
+                act_cmd.row = row;
+                act_cmd.original_addr = addr_trans.addr;
+                schedule_ddr_command(act_cmd);
+                
+                ddr_cmd.cmd_type = DDRCommand::CMD_WRITE;
+                update_page_table(bank, row, true);
+            }
+            
+            ddr_cmd.rank = rank;
+            ddr_cmd.bank = bank;
+            ddr_cmd.row = row;
+            ddr_cmd.col = col;
+            
+            // Convert 64-bit AXI data to 16x32-bit DFI data in a pooled payload
+            ddr_cmd.payload = payload_pool.alloc();
+            if (ddr_cmd.payload != DDRCommand::NO_PAYLOAD) {
+                DDRPayload& payload = payload_pool[ddr_cmd.payload];
+                for (int i = 0; i < 2; i++) {
+                    payload.data[i] = (data_trans.data >> (i * 32)) & 0xFFFFFFFF;
+                    payload.mask[i] = (data_trans.strb >> (i * 4)) & 0xF;
+                }
+            }
+            
+            schedule_ddr_command(ddr_cmd);
+            
+            // Add to write response queue
+            AXITransaction resp_trans;
+            resp_trans.id = addr_trans.id;
+            resp_trans.resp = addr_trans.resp;
+            write_resp_queue.push(resp_trans);
+            
+        } else if (has_read_work) {
+            bufacc_cycle_mode_wr = false;
+            last_was_write = false;
+            
+            // Process read transaction
+            AXITransaction addr_trans = read_addr_queue.front();
+            read_addr_queue.pop();
+            
+            // Create DDR command
+            DDRCommand ddr_cmd;
+            int rank, bank;
+            sc_uint<ROW_WIDTH> row;
+            sc_uint<COL_WIDTH> col;
+            decode_address(addr_trans.addr, rank, bank, row, col);
+            
+            ddr_cmd.original_addr = addr_trans.addr;
+            
+            // Check for page hit/miss
+            if (count_page_access(bank, row)) {
+                ddr_cmd.cmd_type = DDRCommand::CMD_READ;
+            } else {
+                // Need activate first, then read
+                DDRCommand act_cmd;
+                act_cmd.cmd_type = DDRCommand::CMD_ACT;
+                act_cmd.rank = rank;
+                act_cmd.bank = bank;
+                act_cmd.row = row;
+                act_cmd.original_addr = addr_trans.addr;
+                schedule_ddr_command(act_cmd);
+                
+                ddr_cmd.cmd_type = DDRCommand::CMD_READ;
+                update_page_table(bank, row, true);
+            }
+            
+            ddr_cmd.rank = rank;
+            ddr_cmd.bank = bank;
+            ddr_cmd.row = row;
+            ddr_cmd.col = col;
+            ddr_cmd.buf_index = 0; // Simplified
+            
+            schedule_ddr_command(ddr_cmd);
+            
+            // Read data comes from the backing store (or the data pattern)
+            sc_uint<64> read_data = read_memory_block(addr_trans.addr);
+            
+            AXITransaction resp_trans;
+            resp_trans.id = addr_trans.id;
+            resp_trans.data = read_data;
+            resp_trans.last = true; // Simplified - single beat
+            resp_trans.resp = addr_trans.resp;
+            read_resp_queue.push(resp_trans);
+        }
+    } else {
+        bufacc_cycle_en = false;
+    }
+
+    sleep_while_idle();
+}
+
+// Sequencer Process - executes DDR commands
+template <class Policy>
+void OpenDDRController<Policy>::sequencer_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        seq_state = SEQ_IDLE;
+        total_ddr_commands = 0;
+        payload_pool.release(active_write_payload);
+        active_write_payload = DDRCommand::NO_PAYLOAD;
+        return;
+    }
+
+    // Commands execute in order; wait state lengths come from the Timing policy
+    switch (seq_state) {
+        case SEQ_IDLE:
+            if (!ddr_cmd_queue.empty()) {
+                DDRCommand cmd = ddr_cmd_queue.front();
+                ddr_cmd_queue.pop();
+                
+                if constexpr (Timing::checks) {
+                    update_bank_timing(cmd.bank, cmd);
+                }
+                execute_ddr_command(cmd);
+                total_ddr_commands++;
+                
+                // Transition to appropriate wait state based on command type
+                switch (cmd.cmd_type) {
+                    case DDRCommand::CMD_ACT:
+                        seq_state = SEQ_W_ACT;
+                        seq_wait(Timing::act_cycles);
+                        break;
+                    case DDRCommand::CMD_WRITE:
+                        // Payload stays live while dfi_write_data_process drives it
+                        active_write_payload = cmd.payload;
+                        seq_state = SEQ_W_WR;
+                        seq_wait(Timing::write_cycles);
+                        break;
+                    case DDRCommand::CMD_READ:
+                        seq_state = SEQ_W_RD;
+                        seq_wait(Timing::read_cycles);
+                        break;
+                    case DDRCommand::CMD_PRE:
+                    case DDRCommand::CMD_PREA:
+                        seq_state = SEQ_W_PRE;
+                        seq_wait(Timing::pre_cycles);
+                        break;
+                    case DDRCommand::CMD_REF:
+                        seq_state = SEQ_W_REF;
+                        seq_wait(Timing::ref_cycles);
+                        break;
+                    default:
+                        seq_state = SEQ_IDLE;
+                        break;
+                }
+            }
+            break;
+            
+        case SEQ_W_ACT:
+        case SEQ_W_RD:
+        case SEQ_W_PRE:
+            if (seq_wait_done()) {
+                seq_state = SEQ_IDLE;
+            }
+            break;
+            
+        case SEQ_W_WR:
+            // Write data has been driven; return the payload to the pool
+            if (seq_wait_done()) {
+                payload_pool.release(active_write_payload);
+                active_write_payload = DDRCommand::NO_PAYLOAD;
+                seq_state = SEQ_IDLE;
+            }
+            break;
+            
+        case SEQ_W_REF:
+            if (seq_wait_done()) {
+                seq_state = SEQ_IDLE;
+                // Decrement refresh pending counter when refresh completes
+                if (refresh_pending_counter > 0) {
+                    refresh_pending_counter--;
+                }
+            }
+            break;
+            
+        default:
+            seq_state = SEQ_IDLE;
+            break;
+    }
+
+    if (seq_state == SEQ_IDLE) {
+        sleep_while_idle();
+    }
+}
+
+// Enter the current wait state for the given number of mck cycles.  The
+// sequencer is not re-run on every clock in between: it wakes once at the
+// ready cycle, or early if reset asserts.  The timed wake-up lands just
+// before that edge is visible, so the off-edge guard defers it to the edge
+// itself; the next command then goes out on the edge after, cycles + 1
+// edges after this one.
+template <class Policy>
+void OpenDDRController<Policy>::seq_wait(uint32_t cycles) {
+    seq_ready_cycle = now_cycle() + cycles;
+    next_trigger(mck_period * cycles, mc_rst_b.negedge_event());
+}
+
+// True once the ready cycle is reached; otherwise goes back to sleep
+template <class Policy>
+bool OpenDDRController<Policy>::seq_wait_done() {
+    uint64_t now = now_cycle();
+    if (now >= seq_ready_cycle) {
+        return true;
+    }
+    next_trigger(mck_period * static_cast<double>(seq_ready_cycle - now), mc_rst_b.negedge_event());
+    return false;
+}
+
+// Nothing queued or in flight, and no AXI/APB request being presented
+template <class Policy>
+bool OpenDDRController<Policy>::model_idle() const {
+    return seq_state == SEQ_IDLE && apb_state == APB_IDLE &&
+           write_addr_queue.empty() && write_data_queue.empty() && write_resp_queue.empty() &&
+           read_addr_queue.empty() && read_resp_queue.empty() && ddr_cmd_queue.empty() &&
+           !axi_aw_ready_reg && !axi_w_ready_reg && !axi_b_valid_reg &&
+           !axi_ar_ready_reg && !axi_r_valid_reg &&
+           !mc0_axi_awvalid.read() && !mc0_axi_wvalid.read() && !mc0_axi_arvalid.read() &&
+           !mc_psel.read();
+}
+
+// An idle wake-up (input change or work_event) can land between mck edges.
+// The process then does nothing and resumes on its static mck sensitivity.
+template <class Policy>
+bool OpenDDRController<Policy>::off_clock_edge() const {
+    return !mck.posedge();
+}
+
+// Called last by each mck process: when the model is idle, skip the clocks
+// until something on idle_wake happens instead of re-running every cycle
+template <class Policy>
+void OpenDDRController<Policy>::sleep_while_idle() {
+    if (model_idle()) {
+        next_trigger(idle_wake);
+    }
+}
+
+// DFI Command Process
+template <class Policy>
+void OpenDDRController<Policy>::dfi_command_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        dfi_cs_0_p0.write(0);
+        dfi_cs_0_p1.write(0);
+        dfi_cs_1_p2.write(0);
+        dfi_cs_1_p3.write(0);
+        dfi_address_0_p0.write(0);
+        dfi_address_0_p1.write(0);
+        dfi_address_1_p2.write(0);
+        dfi_address_1_p3.write(0);
+        dfi_reset_n.write(false);
+        dfi_dram_clk_disable_0.write(3);
+        dfi_dram_clk_disable_1.write(3);
+        dfi_dram_ca_disable.write(true);
+        dfi_wck_cs.write(0);
+        dfi_wck_en.write(0);
+        dfi_wck_toggle.write(0);
+        return;
+    }
+
+    // Enable clocks and CA after reset
+    dfi_reset_n.write(true);
+    dfi_dram_clk_disable_0.write(0);
+    dfi_dram_clk_disable_1.write(0);
+    dfi_dram_ca_disable.write(false);
+
+    // DFI command generation based on sequencer state
+    if (seq_state != SEQ_IDLE && !ddr_cmd_queue.empty()) {
+        // Generate realistic DFI commands
+        dfi_cs_0_p0.write(1); // Chip select active
+        dfi_address_0_p0.write(0x55); // Example command encoding
+        
+        // WCK control for DDR
+        dfi_wck_cs.write(1);
+        dfi_wck_en.write(1);
+        dfi_wck_toggle.write(1);
+    } else {
+        // Default NOP command
+        dfi_cs_0_p0.write(0);
+        dfi_cs_0_p1.write(0);
+        dfi_cs_1_p2.write(0);
+        dfi_cs_1_p3.write(0);
+        dfi_address_0_p0.write(0);
+        dfi_address_0_p1.write(0);
+        dfi_address_1_p2.write(0);
+        dfi_address_1_p3.write(0);
+        dfi_wck_cs.write(0);
+        dfi_wck_en.write(0);
+        dfi_wck_toggle.write(0);
+    }
+
+    sleep_while_idle();
+}
+
+// DFI Write Data Process
+template <class Policy>
+void OpenDDRController<Policy>::dfi_write_data_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    // Build this cycle's beat; outputs are all zero in reset and when idle
+    DFIWriteBeat beat;
+
+    // Write data handling for DDR
+    if (mc_rst_b.read() && seq_state == SEQ_W_WR && bufacc_cycle_mode_wr) {
+        // Drive the command's write payload, or fixed patterns if it had none
+        if (active_write_payload != DDRCommand::NO_PAYLOAD) {
+            const DDRPayload& payload = payload_pool[active_write_payload];
+            for (int i = 0; i < 4; i++) {
+                beat.data[i] = payload.data[i];
+            }
+        } else {
+            beat.data[0] = 0x12345678;
+            beat.data[1] = 0x9ABCDEF0;
+            beat.data[2] = 0x11223344;
+            beat.data[3] = 0x55667788;
+        }
+
+        // Enable write data on the first four phases, masks all enabled (0)
+        for (int i = 0; i < 4; i++) {
+            beat.en[i] = 0xF;
+        }
+    }
+
+    // Only phases whose value changed are written
+    dfi_wrdata.write_lanes(beat.data, dfi_wr_shadow.data);
+    dfi_wrdata_mask.write_lanes(beat.mask, dfi_wr_shadow.mask);
+    dfi_wrdata_en.write_lanes(beat.en, dfi_wr_shadow.en);
+
+    sleep_while_idle();
+}
+
+// DFI Read Data Process
+template <class Policy>
+void OpenDDRController<Policy>::dfi_read_data_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        mc_rdrst_b.write(false);
+        mc_rcv_en.write(false);
+        dfi_rddata_en.write(false);
+        return;
+    }
+
+    // Read data handling
+    mc_rdrst_b.write(true);
+    mc_rcv_en.write(true);
+    
+    // Enable read data capture during read operations
+    if (seq_state == SEQ_W_RD) {
+        dfi_rddata_en.write(true);
+    } else {
+        dfi_rddata_en.write(false);
+    }
+
+    sleep_while_idle();
+}
+
+// Refresh Timer Process
+template <class Policy>
+void OpenDDRController<Policy>::refresh_timer_process() {
+    if (!porst_b.read()) {
+        refresh_due = SC_ZERO_TIME;
+        refresh_pending_counter = 0;
+        return;
+    }
+
+    // The first slow_clk edge out of reset arms the timer; after that the
+    // process only wakes when a refresh is due (or reset asserts)
+    sc_time now = sc_time_stamp();
+    if (refresh_due == SC_ZERO_TIME) {
+        refresh_due = now + slow_clk_period * REFRESH_INTERVAL;
+    } else if (now >= refresh_due) {
+        refresh_due += slow_clk_period * REFRESH_INTERVAL;
+        if (refresh_pending_counter < 8) { // Max 8 pending refreshes
+            refresh_pending_counter++;
+            
+            // Only schedule refresh if not too many are pending
+            if (refresh_pending_counter <= 6 && !ddr_cmd_queue.full()) { // Keep some headroom
+                DDRCommand ref_cmd;
+                ref_cmd.cmd_type = DDRCommand::CMD_REF;
+                ref_cmd.rank = 0; // Refresh all ranks
+                schedule_ddr_command(ref_cmd);
+                
+                OPENDDR_MODEL_LOG(REFRESH_SCHEDULED, refresh_pending_counter);
+            }
+        } else {
+            OPENDDR_MODEL_LOG(REFRESH_SKIPPED, refresh_pending_counter);
+        }
+    }
+    
+    next_trigger(refresh_due - now, porst_b.negedge_event());
+}
+
+// Verification Process - only built when Verification::enabled
+template <class Policy>
+void OpenDDRController<Policy>::verification_process() {
+    if (off_clock_edge()) {
+        return;
+    }
+
+    if (!mc_rst_b.read()) {
+        queue_overflow_active = false;
+        return;
+    }
+
+    // Monitors queue sizes for info; no errors are reported
+    
+    // Check for queue overflows with smart logging only (no errors)
+    bool current_overflow = (write_addr_queue.full() || read_addr_queue.full());
+    
+    if (current_overflow && !queue_overflow_active) {
+        // Log when overflow starts (info only)
+        queue_overflow_active = true;
+        OPENDDR_MODEL_LOG(SCHED_QUEUE_HIGH, write_addr_queue.size(), read_addr_queue.size(),
+                    write_addr_queue.capacity());
+    } else if (!current_overflow && queue_overflow_active) {
+        // Log when overflow ends (info only)
+        queue_overflow_active = false;
+        OPENDDR_MODEL_LOG(SCHED_QUEUE_NORMAL, write_addr_queue.size(), read_addr_queue.size());
+    }
+    
+    // Periodic statistics reporting (info only - no errors)
+    uint64_t now = now_cycle();
+    if (now >= next_stats_cycle) { // Every 10k cycles
+        next_stats_cycle = now + 10000;
+        if (total_write_transactions > 0 || total_read_transactions > 0) {
+            OPENDDR_MODEL_LOG(STATS_PERIODIC, total_write_transactions, total_read_transactions,
+                        write_addr_queue.size(), read_addr_queue.size());
+        }
+    }
+
+    sleep_while_idle();
+}
+
+// Helper Functions Implementation
+
+template <class Policy>
+void OpenDDRController<Policy>::reset_model() {
+    seq_state = SEQ_IDLE;
+    apb_state = APB_IDLE;
+    ddr_init_done = false;
+    bufacc_cycle_en = false;
+    bufacc_cycle_mode_wr = false;
+    refresh_due = SC_ZERO_TIME;
+    refresh_pending_counter = 0;
+    seq_ready_cycle = 0;
+    next_stats_cycle = 0;
+    last_was_write = false;
+    for (int i = 0; i < PAGE_TABLE_DEPTH; i++) {
+        bank_last_activate[i] = 0;
+        bank_last_precharge[i] = 0;
+    }
+    
+    // Reset AXI state
+    axi_aw_ready_reg = false;
+    axi_w_ready_reg = false;
+    axi_b_valid_reg = false;
+    axi_ar_ready_reg = false;
+    axi_r_valid_reg = false;
+    
+    // Clear all queues
+    write_addr_queue.clear();
+    write_data_queue.clear();
+    write_resp_queue.clear();
+    read_addr_queue.clear();
+    read_resp_queue.clear();
+    ddr_cmd_queue.clear();
+    payload_pool.reset();
+    active_write_payload = DDRCommand::NO_PAYLOAD;
+    
+    // Reset statistics
+    total_write_transactions = 0;
+    total_read_transactions = 0;
+    total_ddr_commands = 0;
+    page_hits = 0;
+    page_misses = 0;
+    page_conflicts = 0;
+    for (int i = 0; i < PAGE_TABLE_DEPTH; i++) {
+        bank_accesses[i] = 0;
+    }
+    data_errors = 0;
+    address_errors = 0;
+    timing_violations = 0;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::update_page_table(int bank, sc_uint<ROW_WIDTH> row, bool open) {
+    if (bank < PAGE_TABLE_DEPTH) {
+        page_table_vld_memory[bank] = open;
+        if (open) {
+            page_table_row_memory[bank] = row;
+        }
+    }
+}
+
+template <class Policy>
+bool OpenDDRController<Policy>::check_page_hit(int bank, sc_uint<ROW_WIDTH> row) {
+    if (bank < PAGE_TABLE_DEPTH && page_table_vld_memory[bank]) {
+        return (page_table_row_memory[bank] == row);
+    }
+    return false;
+}
+
+// Classifies a column access as a page hit, a miss on a closed bank or a
+// conflict with another open row, and counts it against its bank
+template <class Policy>
+bool OpenDDRController<Policy>::count_page_access(int bank, sc_uint<ROW_WIDTH> row) {
+    if (bank < PAGE_TABLE_DEPTH) {
+        bank_accesses[bank]++;
+    }
+    if (check_page_hit(bank, row)) {
+        page_hits++;
+        return true;
+    }
+    page_misses++;
+    if (bank < PAGE_TABLE_DEPTH && page_table_vld_memory[bank]) {
+        page_conflicts++;
+    }
+    return false;
+}
+
+template <class Policy>
+bool OpenDDRController<Policy>::schedule_ddr_command(DDRCommand cmd) {
+    cmd.issue_cycle = now_cycle();
+    if (!ddr_cmd_queue.push(cmd)) {
+        payload_pool.release(cmd.payload);
+        return false;
+    }
+    // Wake the sequencer if the model was idle (e.g. a refresh)
+    work_event.notify(SC_ZERO_TIME);
+    return true;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::execute_ddr_command(const DDRCommand& cmd) {
+    switch (cmd.cmd_type) {
+        case DDRCommand::CMD_ACT:
+            OPENDDR_MODEL_LOG(DFI_ACTIVATE, cmd.bank, cmd.row);
+            break;
+        case DDRCommand::CMD_READ:
+            OPENDDR_MODEL_LOG(DFI_READ, cmd.bank, cmd.col);
+            break;
+        case DDRCommand::CMD_WRITE:
+            OPENDDR_MODEL_LOG(DFI_WRITE, cmd.bank, cmd.col);
+            break;
+        case DDRCommand::CMD_PRE:
+            OPENDDR_MODEL_LOG(DFI_PRECHARGE, cmd.bank);
+            break;
+        case DDRCommand::CMD_REF:
+            OPENDDR_MODEL_LOG(DFI_REFRESH);
+            break;
+        default:
+            OPENDDR_MODEL_LOG(DFI_NOP);
+            break;
+    }
+}
+
+template <class Policy>
+sc_uint<32> OpenDDRController<Policy>::read_register(sc_uint<10> addr) const {
+    switch (addr.to_uint()) {
+        case 0x000: return seq_control_reg;
+        case 0x004: return buf_config_reg;
+        case 0x008: return ddr_config_reg;
+        case 0x00C: return ddr_adr_config_reg;
+        case 0x010: return pmu_cmd_reg;
+        case 0x014: return pmu_mrs_reg;
+        case 0x018: return pmu_mpc_reg;
+        case 0x01C: return pmu_status_reg;
+        case 0x020: return ac_timing_reg1;
+        case 0x024: return ac_timing_reg2;
+        case 0x028: return ac_timing_reg3;
+        case 0x02C: return ac_timing_reg4;
+        case 0x030: return ac_timing_reg5;
+        case 0x034: return ac_timing_reg6;
+        case 0x038: return ac_timing_reg7;
+        case 0x03C: return ac_timing_reg8;
+        case 0x040: return ac_timing_reg9;
+        case 0x044: return ac_timing_reg10;
+        case 0x048: return refresh_cntrl_reg;
+        case 0x04C: return test_config_reg;
+        case 0x100: return total_write_transactions;
+        case 0x104: return total_read_transactions;
+        case 0x108: return total_ddr_commands;
+        case 0x10C: return page_hits;
+        case 0x110: return page_misses;
+        case 0x114: return data_errors;
+        case 0x118: return address_errors;
+        case 0x11C: return timing_violations;
+        default: return 0xDEADBEEF;
+    }
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::write_register(sc_uint<10> addr, sc_uint<32> data) {
+    switch (addr.to_uint()) {
+        case 0x000: seq_control_reg = data; break;
+        case 0x004: buf_config_reg = data; break;
+        case 0x008: ddr_config_reg = data; break;
+        case 0x00C: ddr_adr_config_reg = data; break;
+        case 0x010: pmu_cmd_reg = data; break;
+        case 0x014: pmu_mrs_reg = data; break;
+        case 0x018: pmu_mpc_reg = data; break;
+        case 0x01C: pmu_status_reg = data; break;
+        case 0x020: ac_timing_reg1 = data; break;
+        case 0x024: ac_timing_reg2 = data; break;
+        case 0x028: ac_timing_reg3 = data; break;
+        case 0x02C: ac_timing_reg4 = data; break;
+        case 0x030: ac_timing_reg5 = data; break;
+        case 0x034: ac_timing_reg6 = data; break;
+        case 0x038: ac_timing_reg7 = data; break;
+        case 0x03C: ac_timing_reg8 = data; break;
+        case 0x040: ac_timing_reg9 = data; break;
+        case 0x044: ac_timing_reg10 = data; break;
+        case 0x048: refresh_cntrl_reg = data; break;
+        case 0x04C: test_config_reg = data; break;
+        default: break;
+    }
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::decode_address(sc_uint<40> addr, int& rank, int& bank, 
+                                               sc_uint<ROW_WIDTH>& row, sc_uint<COL_WIDTH>& col) {
+    uint32_t row_bits, col_bits;
+    AddressMap::decode(addr.to_uint64(), rank, bank, row_bits, col_bits);
+    row = row_bits;
+    col = col_bits;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::print_statistics() {
+    std::cout << "\n=== " << Policy::name() << " Statistics ===" << std::endl;
+    std::cout << "Total Write Transactions: " << std::setfill('0') << std::setw(9) 
+              << total_write_transactions << std::endl;
+    std::cout << "Total Read Transactions:  " << std::setfill('0') << std::setw(9) 
+              << total_read_transactions << std::endl;
+    std::cout << "Total DDR Commands:       " << std::setfill('0') << std::setw(9) 
+              << total_ddr_commands << std::endl;
+    std::cout << "Page Hits:                " << std::setfill('0') << std::setw(9) 
+              << page_hits << std::endl;
+    std::cout << "Page Misses:              " << std::setfill('0') << std::setw(9) 
+              << page_misses << std::endl;
+    std::cout << "Page Conflicts:           " << std::setfill('0') << std::setw(9) 
+              << page_conflicts << std::endl;
+    std::cout << "Data Errors:              " << std::setfill('0') << std::setw(9) 
+              << data_errors << std::endl;
+    std::cout << "Address Errors:           " << std::setfill('0') << std::setw(9) 
+              << address_errors << std::endl;
+    std::cout << "Timing Violations:        " << std::setfill('0') << std::setw(9) 
+              << timing_violations << std::endl;
+    
+    if (page_hits + page_misses > 0) {
+        double hit_rate = (double)page_hits / (page_hits + page_misses) * 100.0;
+        std::cout << "Page Hit Rate:            " << std::fixed << std::setprecision(2) 
+                  << hit_rate << "%" << std::endl;
+    }
+    print_queue_high_water();
+    std::cout << "=================================================" << std::endl;
+}
+
+template <class Policy>
+ModelStatistics OpenDDRController<Policy>::statistics() const {
+    ModelStatistics stats;
+    stats.total_write_transactions = total_write_transactions;
+    stats.total_read_transactions = total_read_transactions;
+    stats.total_ddr_commands = total_ddr_commands;
+    stats.page_hits = page_hits;
+    stats.page_misses = page_misses;
+    stats.page_conflicts = page_conflicts;
+    for (int i = 0; i < PAGE_TABLE_DEPTH && i < ModelStatistics::BANKS; i++) {
+        stats.bank_accesses[i] = bank_accesses[i];
+        stats.open_banks += page_table_vld_memory[i] ? 1 : 0;
+    }
+    stats.data_errors = data_errors;
+    stats.address_errors = address_errors;
+    stats.timing_violations = timing_violations;
+    stats.write_addr_queue_hwm = write_addr_queue.high_water();
+    stats.write_data_queue_hwm = write_data_queue.high_water();
+    stats.write_resp_queue_hwm = write_resp_queue.high_water();
+    stats.read_addr_queue_hwm = read_addr_queue.high_water();
+    stats.read_resp_queue_hwm = read_resp_queue.high_water();
+    stats.ddr_cmd_queue_hwm = ddr_cmd_queue.high_water();
+    stats.write_addr_queue_depth = write_addr_queue.size();
+    stats.write_data_queue_depth = write_data_queue.size();
+    stats.write_resp_queue_depth = write_resp_queue.size();
+    stats.read_addr_queue_depth = read_addr_queue.size();
+    stats.read_resp_queue_depth = read_resp_queue.size();
+    stats.ddr_cmd_queue_depth = ddr_cmd_queue.size();
+    return stats;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::print_queue_high_water() {
+    std::cout << "Queue High-Water Marks (used/capacity):" << std::endl;
+    std::cout << "  Write Addr: " << write_addr_queue.high_water() << "/" << write_addr_queue.capacity()
+              << "  Write Data: " << write_data_queue.high_water() << "/" << write_data_queue.capacity()
+              << "  Write Resp: " << write_resp_queue.high_water() << "/" << write_resp_queue.capacity() << std::endl;
+    std::cout << "  Read Addr:  " << read_addr_queue.high_water() << "/" << read_addr_queue.capacity()
+              << "  Read Resp:  " << read_resp_queue.high_water() << "/" << read_resp_queue.capacity()
+              << "  DDR Cmd:    " << ddr_cmd_queue.high_water() << "/" << ddr_cmd_queue.capacity() << std::endl;
+}
+
+// Checkpoint/restore
+
+template <class Policy>
+bool OpenDDRController<Policy>::save_checkpoint(const std::string& path, std::string& error) {
+    using namespace OpenDDRCheckpoint;
+    static_assert(PAGE_TABLE_DEPTH == BANKS, "checkpoint bank count must match the page table");
+
+    ControllerState state;
+    memset(&state, 0, sizeof(state));
+    state.cycle = now_cycle();
+    state.seq_ready_cycle = seq_ready_cycle;
+    state.next_stats_cycle = next_stats_cycle;
+    if (refresh_due != SC_ZERO_TIME) {
+        sc_time remaining = refresh_due > sc_time_stamp() ? refresh_due - sc_time_stamp() : SC_ZERO_TIME;
+        state.refresh_remaining_ps = static_cast<uint64_t>(remaining / sc_time(1, SC_PS)) + 1;
+    }
+    for (int i = 0; i < BANKS; i++) {
+        state.bank_last_activate[i] = bank_last_activate[i];
+        state.bank_last_precharge[i] = bank_last_precharge[i];
+        state.page_table_row[i] = page_table_row_memory[i].to_uint();
+        state.page_table_valid[i] = page_table_vld_memory[i];
+    }
+    for (int i = 0; i < REGISTERS; i++) {
+        state.registers[i] = read_register(i * 4).to_uint();
+    }
+    for (int i = 0; i < COUNTERS; i++) {
+        state.counters[i] = read_register(0x100 + i * 4).to_uint();
+    }
+    state.active_write_payload = active_write_payload;
+    state.seq_state = seq_state;
+    state.apb_state = apb_state;
+    state.current_pattern = current_pattern;
+    state.refresh_pending_counter = refresh_pending_counter.to_uint();
+    state.flags = (ddr_init_done ? FLAG_DDR_INIT_DONE : 0) |
+                  (bufacc_cycle_en ? FLAG_BUFACC_CYCLE_EN : 0) |
+                  (bufacc_cycle_mode_wr ? FLAG_BUFACC_CYCLE_MODE_WR : 0) |
+                  (last_was_write ? FLAG_LAST_WAS_WRITE : 0) |
+                  (queue_overflow_active ? FLAG_QUEUE_OVERFLOW_ACTIVE : 0) |
+                  (axi_aw_ready_reg ? FLAG_AXI_AW_READY : 0) |
+                  (axi_w_ready_reg ? FLAG_AXI_W_READY : 0) |
+                  (axi_b_valid_reg ? FLAG_AXI_B_VALID : 0) |
+                  (axi_ar_ready_reg ? FLAG_AXI_AR_READY : 0) |
+                  (axi_r_valid_reg ? FLAG_AXI_R_VALID : 0);
+
+    Writer writer(Policy::name());
+    writer.begin_section(SEC_CONTROLLER, sizeof(state));
+    writer.append(&state, sizeof(state));
+
+    auto save_queue = [&writer](uint32_t id, const auto& queue) {
+        typedef typename std::decay<decltype(queue.front())>::type Record;
+        writer.begin_section(id, sizeof(Record));
+        for (size_t i = 0; i < queue.size(); i++) {
+            writer.append(&queue.at(i), sizeof(Record));
+        }
+    };
+    save_queue(SEC_WRITE_ADDR_QUEUE, write_addr_queue);
+    save_queue(SEC_WRITE_DATA_QUEUE, write_data_queue);
+    save_queue(SEC_WRITE_RESP_QUEUE, write_resp_queue);
+    save_queue(SEC_READ_ADDR_QUEUE, read_addr_queue);
+    save_queue(SEC_READ_RESP_QUEUE, read_resp_queue);
+    save_queue(SEC_DDR_CMD_QUEUE, ddr_cmd_queue);
+
+    writer.begin_section(SEC_PAYLOAD_POOL, sizeof(DDRPayload));
+    writer.append(payload_pool.payloads(), payload_pool.capacity() * sizeof(DDRPayload));
+    writer.begin_section(SEC_PAYLOAD_FREE_LIST, sizeof(uint16_t));
+    writer.append(payload_pool.free_handles().data(), payload_pool.free_handles().size() * sizeof(uint16_t));
+
+    uint64_t blocks = 0;
+    writer.begin_section(SEC_MEMORY_BLOCKS, sizeof(uint64_t) + MEMORY_BLOCK_SIZE);
+    memory_store.for_each_block([&writer, &blocks](uint64_t block_addr, const uint8_t* data) {
+        writer.append_copy(&block_addr, sizeof(block_addr));
+        writer.append_copy(data, MEMORY_BLOCK_SIZE);
+        blocks++;
+    });
+
+    std::ostringstream rng;
+    rng << random_generator;
+    writer.begin_section(SEC_RNG, 1);
+    writer.append_copy(rng.str().data(), rng.str().size());
+
+    StatsState stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.page_conflicts = page_conflicts.to_uint();
+    for (int i = 0; i < BANKS; i++) {
+        stats.bank_accesses[i] = bank_accesses[i];
+    }
+    writer.begin_section(SEC_STATS, sizeof(stats));
+    writer.append_copy(&stats, sizeof(stats));
+
+    if (!writer.write(path, error)) {
+        return false;
+    }
+    OPENDDR_MODEL_LOG(CKPT_SAVED, state.cycle, blocks);
+    return true;
+}
+
+template <class Policy>
+bool OpenDDRController<Policy>::restore_checkpoint(const std::string& path, std::string& error) {
+    using namespace OpenDDRCheckpoint;
+
+    Reader reader;
+    if (!reader.open(path, Policy::name(), error)) {
+        return false;
+    }
+
+    size_t count;
+    const ControllerState* state = reader.records<ControllerState>(SEC_CONTROLLER, count);
+    if (count != 1) {
+        error = path + ": no controller state";
+        return false;
+    }
+
+    // Check that everything fits before touching the model
+    auto queue_fits = [&reader, &error, &path](uint32_t id, const auto& queue, const char* name) {
+        typedef typename std::decay<decltype(queue.front())>::type Record;
+        size_t n;
+        reader.template records<Record>(id, n);
+        if (n > queue.capacity()) {
+            error = path + ": " + name + " holds " + std::to_string(n) + " entries, capacity is " +
+                    std::to_string(queue.capacity()) + " (restore with the saving ModelConfig)";
+            return false;
+        }
+        return true;
+    };
+    if (!queue_fits(SEC_WRITE_ADDR_QUEUE, write_addr_queue, "write address queue") ||
+        !queue_fits(SEC_WRITE_DATA_QUEUE, write_data_queue, "write data queue") ||
+        !queue_fits(SEC_WRITE_RESP_QUEUE, write_resp_queue, "write response queue") ||
+        !queue_fits(SEC_READ_ADDR_QUEUE, read_addr_queue, "read address queue") ||
+        !queue_fits(SEC_READ_RESP_QUEUE, read_resp_queue, "read response queue") ||
+        !queue_fits(SEC_DDR_CMD_QUEUE, ddr_cmd_queue, "DDR command queue")) {
+        return false;
+    }
+    size_t payload_count, free_count;
+    const DDRPayload* payloads = reader.records<DDRPayload>(SEC_PAYLOAD_POOL, payload_count);
+    const uint16_t* free_handles = reader.records<uint16_t>(SEC_PAYLOAD_FREE_LIST, free_count);
+    if (!payload_pool.restore(payloads, payload_count, free_handles, free_count)) {
+        error = path + ": payload pool size differs (restore with the saving ModelConfig)";
+        return false;
+    }
+
+    auto load_queue = [&reader](uint32_t id, auto& queue) {
+        typedef typename std::decay<decltype(queue.front())>::type Record;
+        size_t n;
+        const Record* records = reader.template records<Record>(id, n);
+        queue.clear();
+        for (size_t i = 0; i < n; i++) {
+            queue.push(records[i]);
+        }
+    };
+    load_queue(SEC_WRITE_ADDR_QUEUE, write_addr_queue);
+    load_queue(SEC_WRITE_DATA_QUEUE, write_data_queue);
+    load_queue(SEC_WRITE_RESP_QUEUE, write_resp_queue);
+    load_queue(SEC_READ_ADDR_QUEUE, read_addr_queue);
+    load_queue(SEC_READ_RESP_QUEUE, read_resp_queue);
+    load_queue(SEC_DDR_CMD_QUEUE, ddr_cmd_queue);
+
+    size_t blocks;
+    const uint8_t* block_records = static_cast<const uint8_t*>(
+        reader.section(SEC_MEMORY_BLOCKS, sizeof(uint64_t) + MEMORY_BLOCK_SIZE, blocks));
+    memory_store.clear();
+    for (size_t i = 0; i < blocks; i++) {
+        const uint8_t* record = block_records + i * (sizeof(uint64_t) + MEMORY_BLOCK_SIZE);
+        uint64_t block_addr;
+        memcpy(&block_addr, record, sizeof(block_addr));
+        memory_store.restore_block(block_addr, record + sizeof(block_addr));
+    }
+
+    size_t rng_size;
+    const char* rng = static_cast<const char*>(reader.section(SEC_RNG, 1, rng_size));
+    if (rng_size > 0) {
+        std::istringstream in(std::string(rng, rng_size));
+        in >> random_generator;
+    }
+
+    // Scalar state; the cycle count continues from the checkpoint
+    cycle_base = 0;
+    cycle_base = state->cycle - now_cycle();
+    seq_ready_cycle = state->seq_ready_cycle;
+    next_stats_cycle = state->next_stats_cycle;
+    refresh_due = state->refresh_remaining_ps
+                      ? sc_time_stamp() + sc_time(static_cast<double>(state->refresh_remaining_ps - 1), SC_PS)
+                      : SC_ZERO_TIME;
+    for (int i = 0; i < BANKS; i++) {
+        bank_last_activate[i] = state->bank_last_activate[i];
+        bank_last_precharge[i] = state->bank_last_precharge[i];
+        page_table_row_memory[i] = state->page_table_row[i];
+        page_table_vld_memory[i] = state->page_table_valid[i] != 0;
+    }
+    for (int i = 0; i < REGISTERS; i++) {
+        write_register(i * 4, state->registers[i]);
+    }
+    total_write_transactions = state->counters[0];
+    total_read_transactions = state->counters[1];
+    total_ddr_commands = state->counters[2];
+    page_hits = state->counters[3];
+    page_misses = state->counters[4];
+    data_errors = state->counters[5];
+    address_errors = state->counters[6];
+    timing_violations = state->counters[7];
+    const StatsState* stats = reader.records<StatsState>(SEC_STATS, count);
+    page_conflicts = count == 1 ? stats->page_conflicts : 0;
+    for (int i = 0; i < BANKS; i++) {
+        bank_accesses[i] = count == 1 ? stats->bank_accesses[i] : 0;
+    }
+    active_write_payload = state->active_write_payload;
+    seq_state = static_cast<SequencerState>(state->seq_state);
+    apb_state = static_cast<APBState>(state->apb_state);
+    current_pattern = static_cast<DataPattern>(state->current_pattern);
+    refresh_pending_counter = state->refresh_pending_counter;
+    ddr_init_done = state->flags & FLAG_DDR_INIT_DONE;
+    bufacc_cycle_en = state->flags & FLAG_BUFACC_CYCLE_EN;
+    bufacc_cycle_mode_wr = state->flags & FLAG_BUFACC_CYCLE_MODE_WR;
+    last_was_write = state->flags & FLAG_LAST_WAS_WRITE;
+    queue_overflow_active = state->flags & FLAG_QUEUE_OVERFLOW_ACTIVE;
+    axi_aw_ready_reg = state->flags & FLAG_AXI_AW_READY;
+    axi_w_ready_reg = state->flags & FLAG_AXI_W_READY;
+    axi_b_valid_reg = state->flags & FLAG_AXI_B_VALID;
+    axi_ar_ready_reg = state->flags & FLAG_AXI_AR_READY;
+    axi_r_valid_reg = state->flags & FLAG_AXI_R_VALID;
+
+    // Idle processes re-evaluate against the restored queues
+    work_event.notify(SC_ZERO_TIME);
+
+    OPENDDR_MODEL_LOG(CKPT_RESTORED, state->cycle, blocks);
+    return true;
+}
+
+// Verification helpers
+template <class Policy>
+sc_uint<64> OpenDDRController<Policy>::generate_data_pattern(sc_uint<40> addr, DataPattern pattern) {
+    sc_uint<64> data = 0;
+    
+    switch (pattern) {
+        case PATTERN_INCREMENTAL:
+            data = addr & 0xFFFFFFFFFFFFFFFFULL;
+            break;
+        case PATTERN_WALKING_ONES:
+            data = 1ULL << (addr & 0x3F);
+            break;
+        case PATTERN_WALKING_ZEROS:
+            data = ~(1ULL << (addr & 0x3F));
+            break;
+        case PATTERN_CHECKERBOARD:
+            data = (addr & 1) ? 0xAAAAAAAAAAAAAAAAULL : 0x5555555555555555ULL;
+            break;
+        case PATTERN_RANDOM:
+            data = random_generator();
+            data = (data << 32) | random_generator();
+            break;
+        case PATTERN_ADDRESS_BASED:
+            data = addr;
+            data = (data << 32) | (~addr & 0xFFFFFFFF);
+            break;
+        case PATTERN_CUSTOM:
+            data = 0x123456789ABCDEF0ULL;
+            break;
+        default:
+            data = 0;
+            break;
+    }
+    
+    return data;
+}
+
+template <class Policy>
+bool OpenDDRController<Policy>::verify_data_pattern(sc_uint<40> addr, sc_uint<64> data, DataPattern pattern) {
+    // Data checking is not modelled; every read is accepted
+    (void)addr; // Suppress unused parameter warnings
+    (void)data;
+    (void)pattern;
+    return true;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::write_memory_block(sc_uint<40> addr, sc_uint<64> data, sc_uint<8> strb) {
+    memory_store.write(addr.to_uint64(), data.to_uint64(), strb.to_uint());
+    
+    OPENDDR_MODEL_LOG(MEM_WRITE, addr, data, strb, addr.to_uint64() & ~(uint64_t)(MEMORY_BLOCK_SIZE - 1),
+                      addr.to_uint64() & (MEMORY_BLOCK_SIZE - 1));
+}
+
+template <class Policy>
+sc_uint<64> OpenDDRController<Policy>::read_memory_block(sc_uint<40> addr) {
+    uint64_t stored;
+    sc_uint<64> data;
+    
+    if (memory_store.read(addr.to_uint64(), stored)) {
+        data = stored;
+        OPENDDR_MODEL_LOG(MEM_READ, addr, data, addr.to_uint64() & ~(uint64_t)(MEMORY_BLOCK_SIZE - 1),
+                          addr.to_uint64() & (MEMORY_BLOCK_SIZE - 1), true);
+    } else {
+        // Return pattern for uninitialized memory
+        data = generate_data_pattern(addr, current_pattern);
+        OPENDDR_MODEL_LOG(MEM_READ_UNINIT, addr, data);
+    }
+    
+    return data;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::update_bank_timing(int bank, const DDRCommand& cmd) {
+    if (bank >= PAGE_TABLE_DEPTH) {
+        return;
+    }
+    
+    switch (cmd.cmd_type) {
+        case DDRCommand::CMD_ACT:
+            bank_last_activate[bank] = now_cycle();
+            break;
+        case DDRCommand::CMD_PRE:
+        case DDRCommand::CMD_PREA:
+            bank_last_precharge[bank] = now_cycle();
+            break;
+        default:
+            break;
+    }
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::log_verification_error(const std::string& error_type, 
+                                                       sc_uint<40> addr, const std::string& details) {
+    // Verification errors are not reported by this model
+    (void)error_type; // Suppress unused parameter warnings
+    (void)addr;
+    (void)details;
+}
+
+// Test pattern generators (not implemented by this model)
+template <class Policy>
+void OpenDDRController<Policy>::run_address_test() {
+    std::cout << "Address test disabled - no verification" << std::endl;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::run_data_pattern_test() {
+    std::cout << "Data pattern test disabled - no verification" << std::endl;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::run_burst_test() {
+    std::cout << "Burst test disabled - no verification" << std::endl;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::run_bank_interleaving_test() {
+    std::cout << "Bank interleaving test disabled - no verification" << std::endl;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::run_refresh_test() {
+    std::cout << "Refresh test disabled - no verification" << std::endl;
+}
+
+template <class Policy>
+void OpenDDRController<Policy>::run_timing_test() {
+    std::cout << "Timing test disabled - no verification" << std::endl;
+}
+
+#endif // OPENDDR_CONTROLLER_IMPL_H
@@ -0,0 +1,105 @@
+#ifndef OPENDDR_CONTROLLER_POLICIES_H
+#define OPENDDR_CONTROLLER_POLICIES_H
+
+// Compile-time policies for OpenDDRController.
+//
+// A model variant is a policy struct naming one of each:
+//   Scheduler    - read/write arbitration
+//   Timing       - sequencer wait cycles, and whether timing is checked
+//   Verification - whether the verification monitor is built
+//   Logging      - highest event level compiled into the controller
+//   Store        - backing store (see openddr_memory_store.h)
+//   AddressMap   - AXI address to rank/bank/row/col
+// plus default_config() and name().  Everything a policy turns off is
+// removed with if constexpr, so disabled features cost nothing at runtime.
+
+#include <cstdint>
+#include "openddr_log.h"
+#include "openddr_memory_store.h"
+#include "openddr_model_config.h"
+
+// Scheduler: called when both kinds of work may be pending; true picks the write
+
+// Writes always go first
+struct WriteFirstScheduler {
+    static bool pick_write(bool has_write, bool has_read, bool last_was_write) {
+        (void)has_read;
+        (void)last_was_write;
+        return has_write;
+    }
+};
+
+// Alternate between writes and reads while both are pending
+struct AlternatingScheduler {
+    static bool pick_write(bool has_write, bool has_read, bool last_was_write) {
+        return has_write && (!has_read || !last_was_write);
+    }
+};
+
+// Timing: mck cycles the sequencer stays in each wait state
+
+// Simplified DDR timing; with Checks, each bank's last ACT and PRE cycle is
+// tracked.  Commands are not checked against them: the sequencer runs one
+// command at a time and always waits act_cycles after an ACT, so a tRCD
+// check could never fail.
+template <bool Checks>
+struct SimplifiedTiming {
+    static constexpr bool checks = Checks;
+    static constexpr uint32_t act_cycles = 3;    // tRCD
+    static constexpr uint32_t write_cycles = 2;
+    static constexpr uint32_t read_cycles = 4;
+    static constexpr uint32_t pre_cycles = 2;    // tRP
+    static constexpr uint32_t ref_cycles = 10;   // tRFC
+};
+
+// Every command completes in one cycle; no checks
+struct SingleCycleTiming {
+    static constexpr bool checks = false;
+    static constexpr uint32_t act_cycles = 1;
+    static constexpr uint32_t write_cycles = 1;
+    static constexpr uint32_t read_cycles = 1;
+    static constexpr uint32_t pre_cycles = 1;
+    static constexpr uint32_t ref_cycles = 1;
+};
+
+// Verification: the monitor process (queue overflow tracking, periodic stats)
+
+struct VerificationOn {
+    static constexpr bool enabled = true;
+};
+
+struct VerificationOff {
+    static constexpr bool enabled = false;
+};
+
+// Logging: events above MaxLevel are compiled out of the controller
+template <int MaxLevel = OPENDDR_LOG_MAX_LEVEL>
+struct LogUpTo {
+    static constexpr int max_level = MaxLevel;
+};
+
+// Address maps
+
+// Bank bits just above the 64-byte line so consecutive lines spread over
+// 16 banks: rank[30], row[25:10], bank[9:6], col[12:3]
+struct InterleavedAddressMap {
+    static void decode(uint64_t addr, int& rank, int& bank, uint32_t& row, uint32_t& col) {
+        rank = (addr >> 30) & 0x1;
+        bank = (addr >> 6) & 0xF;
+        row = (addr >> 10) & 0xFFFF;
+        col = (addr >> 3) & 0x3FF;
+    }
+};
+
+// CS, ROW, BANK, COL from the top down: rank[31], row[30:15], bank[14:12],
+// col[11:2]
+struct LinearAddressMap {
+    static void decode(uint64_t addr, int& rank, int& bank, uint32_t& row, uint32_t& col) {
+        rank = (addr >> 31) & 0x1;
+        bank = (addr >> 12) & 0x7;
+        row = (addr >> 15) & 0xFFFF;
+        col = (addr >> 2) & 0x3FF;
+    }
+};
+
+#endif // OPENDDR_CONTROLLER_POLICIES_H
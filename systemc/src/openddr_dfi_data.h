@@ -0,0 +1,111 @@
+#ifndef OPENDDR_DFI_DATA_H
+#define OPENDDR_DFI_DATA_H
+
+// DFI write/read data buses (16 phases per beat).
+//
+// By default each bus is an sc_vector with one port or signal per phase.
+// With OPENDDR_DFI_PACKED defined, each bus is a single packed sc_bv (phase i
+// in bits [W*i+W-1 : W*i]), so a whole beat costs one kernel update.
+//
+// DFIDataBus hides the difference: bind it like a port (port(signal)), read
+// a phase with lane(i) and drive a beat with write_lanes().  Passing a shadow
+// array to write_lanes() makes it skip phases (or the whole packed bus) whose
+// value has not changed, so idle cycles request no updates at all.
+
+#include <systemc.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+static const int DFI_DATA_PHASES = 16;
+
+template <typename T> using dfi_in = sc_in<T>;
+template <typename T> using dfi_out = sc_out<T>;
+template <typename T> using dfi_signal = sc_signal<T>;
+
+#ifdef OPENDDR_DFI_PACKED
+
+template <int W, template <typename> class P>
+class DFIDataBus : public P<sc_bv<DFI_DATA_PHASES * W>> {
+public:
+    typedef P<sc_bv<DFI_DATA_PHASES * W>> base_type;
+
+    explicit DFIDataBus(const char* name) : base_type(name) {}
+
+    uint32_t lane(int i) const {
+        return this->read().range(W * i + W - 1, W * i).to_uint();
+    }
+
+    void write_lanes(const uint32_t* lanes) {
+        sc_bv<DFI_DATA_PHASES * W> bus;
+        for (int i = 0; i < DFI_DATA_PHASES; i++) {
+            bus.range(W * i + W - 1, W * i) = lanes[i];
+        }
+        this->write(bus);
+    }
+
+    void write_lanes(const uint32_t* lanes, uint32_t* shadow) {
+        if (memcmp(lanes, shadow, DFI_DATA_PHASES * sizeof(uint32_t)) != 0) {
+            write_lanes(lanes);
+            memcpy(shadow, lanes, DFI_DATA_PHASES * sizeof(uint32_t));
+        }
+    }
+
+    void trace(sc_trace_file* tf, const std::string& name) const {
+        sc_trace(tf, static_cast<const base_type&>(*this), name);
+    }
+};
+
+#else
+
+template <int W, template <typename> class P>
+class DFIDataBus : public sc_vector<P<sc_uint<W>>> {
+public:
+    typedef sc_vector<P<sc_uint<W>>> base_type;
+
+    explicit DFIDataBus(const char* name) : base_type(name, DFI_DATA_PHASES) {}
+
+    uint32_t lane(int i) const {
+        return (*this)[i].read();
+    }
+
+    void write_lanes(const uint32_t* lanes) {
+        for (int i = 0; i < DFI_DATA_PHASES; i++) {
+            (*this)[i].write(lanes[i]);
+        }
+    }
+
+    void write_lanes(const uint32_t* lanes, uint32_t* shadow) {
+        for (int i = 0; i < DFI_DATA_PHASES; i++) {
+            if (lanes[i] != shadow[i]) {
+                (*this)[i].write(lanes[i]);
+                shadow[i] = lanes[i];
+            }
+        }
+    }
+
+    void trace(sc_trace_file* tf, const std::string& name) const {
+        for (int i = 0; i < DFI_DATA_PHASES; i++) {
+            sc_trace(tf, (*this)[i], name + "_" + std::to_string(i));
+        }
+    }
+};
+
+#endif // OPENDDR_DFI_PACKED
+
+// Port and signal flavours: W is the per-phase width
+template <int W> using DFIDataIn = DFIDataBus<W, dfi_in>;
+template <int W> using DFIDataOut = DFIDataBus<W, dfi_out>;
+template <int W> using DFIDataSignal = DFIDataBus<W, dfi_signal>;
+
+// One write-data beat as driven onto the DFI (also used as the shadow copy)
+struct DFIWriteBeat {
+    uint32_t data[DFI_DATA_PHASES];
+    uint32_t mask[DFI_DATA_PHASES];
+    uint32_t en[DFI_DATA_PHASES];
+
+    DFIWriteBeat() { clear(); }
+    void clear() { memset(this, 0, sizeof(*this)); }
+};
+
+#endif // OPENDDR_DFI_DATA_H
@@ -0,0 +1,309 @@
+#include "openddr_log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <strings.h>
+#include <thread>
+#include <vector>
+
+namespace OpenDDRLog {
+
+std::atomic<uint8_t> g_level(LVL_INFO);
+std::atomic<uint32_t> g_category_mask((1u << CAT_COUNT) - 1);
+
+namespace {
+
+// Bounded multi-producer / single-consumer ring (Vyukov-style sequence
+// numbers).  Producers never block: a full ring drops the record.
+class RecordRing {
+public:
+    explicit RecordRing(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) {
+            cap <<= 1;
+        }
+        mask = cap - 1;
+        slots.reset(new Slot[cap]);
+        for (size_t i = 0; i < cap; i++) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(const Record& rec) {
+        size_t pos = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & mask];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.rec = rec;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(Record& rec) {
+        Slot& slot = slots[tail & mask];
+        size_t seq = slot.seq.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail + 1) < 0) {
+            return false;  // Empty
+        }
+        rec = slot.rec;
+        slot.seq.store(tail + mask + 1, std::memory_order_release);
+        tail++;
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> seq;
+        Record rec;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) size_t tail = 0;  // Consumer only
+};
+
+struct BinarySink {
+    std::unique_ptr<RecordRing> ring;
+    FILE* fp = nullptr;
+    std::thread drain_thread;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> dropped{0};
+    uint64_t tick_fs = 1000;
+};
+
+BinarySink g_sink;
+std::atomic<bool> g_sink_active(false);
+std::mutex g_sink_mutex;  // Guards start/stop only
+uint64_t g_text_tick_fs = 1000;
+
+void drain_loop() {
+    std::vector<Record> batch(256);
+    for (;;) {
+        bool running = g_sink.running.load(std::memory_order_acquire);
+        size_t n = 0;
+        while (n < batch.size() && g_sink.ring->pop(batch[n])) {
+            n++;
+        }
+        if (n > 0) {
+            fwrite(batch.data(), sizeof(Record), n, g_sink.fp);
+            continue;
+        }
+        if (!running) {
+            break;  // Stopped and fully drained
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// Make sure the drain thread is joined even if nobody calls stop_binary_sink()
+struct SinkGuard {
+    ~SinkGuard() { stop_binary_sink(); }
+} g_sink_guard;
+
+} // namespace
+
+void set_level(Level level) {
+    g_level.store(level, std::memory_order_relaxed);
+}
+
+void set_categories(uint32_t mask) {
+    g_category_mask.store(mask, std::memory_order_relaxed);
+}
+
+bool parse_level(const std::string& text, Level& level) {
+    for (int i = LVL_ERROR; i <= LVL_TRACE; i++) {
+        if (strcasecmp(text.c_str(), level_name(static_cast<Level>(i))) == 0) {
+            level = static_cast<Level>(i);
+            return true;
+        }
+    }
+    if (text.size() == 1 && text[0] >= '0' && text[0] <= '4') {
+        level = static_cast<Level>(text[0] - '0');
+        return true;
+    }
+    return false;
+}
+
+bool parse_categories(const std::string& text, uint32_t& mask) {
+    uint32_t result = 0;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (strcasecmp(item.c_str(), "all") == 0) {
+            result |= (1u << CAT_COUNT) - 1;
+            continue;
+        }
+        bool found = false;
+        for (int i = 0; i < CAT_COUNT; i++) {
+            if (strcasecmp(item.c_str(), category_name(static_cast<Category>(i))) == 0) {
+                result |= 1u << i;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    mask = result;
+    return true;
+}
+
+void configure_from_env() {
+    if (const char* env = std::getenv("OPENDDR_LOG_LEVEL")) {
+        Level level;
+        if (parse_level(env, level)) {
+            set_level(level);
+        } else {
+            std::cerr << "Ignoring invalid OPENDDR_LOG_LEVEL: " << env << std::endl;
+        }
+    }
+    if (const char* env = std::getenv("OPENDDR_LOG_CATEGORIES")) {
+        uint32_t mask;
+        if (parse_categories(env, mask)) {
+            set_categories(mask);
+        } else {
+            std::cerr << "Ignoring invalid OPENDDR_LOG_CATEGORIES: " << env << std::endl;
+        }
+    }
+    if (const char* env = std::getenv("OPENDDR_LOG_FILE")) {
+        start_binary_sink(env);
+    }
+}
+
+bool start_binary_sink(const std::string& path, size_t ring_capacity, uint64_t tick_fs) {
+    std::lock_guard<std::mutex> lock(g_sink_mutex);
+    if (g_sink_active.load()) {
+        return false;
+    }
+
+    FILE* fp = fopen(path.c_str(), "wb");
+    if (fp == nullptr) {
+        std::cerr << "Failed to open binary log file: " << path << std::endl;
+        return false;
+    }
+
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+    header.version = FILE_VERSION;
+    header.record_size = sizeof(Record);
+    header.tick_fs = tick_fs;
+    fwrite(&header, sizeof(header), 1, fp);
+
+    g_sink.ring.reset(new RecordRing(ring_capacity));
+    g_sink.fp = fp;
+    g_sink.tick_fs = tick_fs;
+    g_sink.dropped.store(0);
+    g_sink.running.store(true);
+    g_sink.drain_thread = std::thread(drain_loop);
+    g_sink_active.store(true, std::memory_order_release);
+    return true;
+}
+
+void stop_binary_sink() {
+    std::lock_guard<std::mutex> lock(g_sink_mutex);
+    if (!g_sink_active.load()) {
+        return;
+    }
+
+    g_sink_active.store(false, std::memory_order_release);
+    g_sink.running.store(false, std::memory_order_release);
+    if (g_sink.drain_thread.joinable()) {
+        g_sink.drain_thread.join();
+    }
+
+    uint64_t dropped = g_sink.dropped.load();
+    if (dropped > 0) {
+        Record rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.event = EV_LOG_DROPPED;
+        rec.nargs = 1;
+        rec.args[0] = dropped;
+        fwrite(&rec, sizeof(rec), 1, g_sink.fp);
+        std::cerr << "OpenDDR log: " << dropped << " records dropped (ring full)" << std::endl;
+    }
+
+    // The ring itself is kept until the next start so that a producer racing
+    // with shutdown never touches freed memory
+    fclose(g_sink.fp);
+    g_sink.fp = nullptr;
+}
+
+bool binary_sink_active() {
+    return g_sink_active.load(std::memory_order_acquire);
+}
+
+uint64_t dropped_records() {
+    return g_sink.dropped.load();
+}
+
+size_t format_record(const Record& rec, uint64_t tick_fs, char* buf, size_t len) {
+    if (rec.event >= EV_COUNT) {
+        return snprintf(buf, len, "@%llu <unknown event %u>",
+                        (unsigned long long)rec.timestamp, (unsigned)rec.event);
+    }
+
+    const EventInfo& info = EVENT_TABLE[rec.event];
+    unsigned long long a[MAX_ARGS];
+    for (int i = 0; i < MAX_ARGS; i++) {
+        a[i] = i < rec.nargs ? rec.args[i] : 0;
+    }
+
+    // Print time in ns with ps precision, like sc_time_stamp() would
+    double ns = (double)rec.timestamp * (double)tick_fs / 1e6;
+    int n = snprintf(buf, len, "@%.3f ns [%s] [%s] ", ns,
+                     level_name(info.level), category_name(info.category));
+    if (n < 0 || (size_t)n >= len) {
+        return len > 0 ? len - 1 : 0;
+    }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int m = snprintf(buf + n, len - n, info.format, a[0], a[1], a[2], a[3], a[4], a[5]);
+#pragma GCC diagnostic pop
+    if (m < 0) {
+        return n;
+    }
+    return std::min(len - 1, (size_t)(n + m));
+}
+
+void emit(EventId ev, uint64_t timestamp, const uint64_t* args, int nargs) {
+    Record rec;
+    rec.timestamp = timestamp;
+    rec.event = ev;
+    rec.nargs = static_cast<uint8_t>(nargs);
+    memset(rec.reserved, 0, sizeof(rec.reserved));
+    for (int i = 0; i < MAX_ARGS; i++) {
+        rec.args[i] = i < nargs ? args[i] : 0;
+    }
+
+    if (g_sink_active.load(std::memory_order_acquire)) {
+        if (!g_sink.ring->push(rec)) {
+            g_sink.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    char line[256];
+    format_record(rec, g_text_tick_fs, line, sizeof(line));
+    puts(line);
+}
+
+} // namespace OpenDDRLog
@@ -0,0 +1,192 @@
+#ifndef OPENDDR_LOG_H
+#define OPENDDR_LOG_H
+
+// Leveled, categorized event logging for the OpenDDR models.
+//
+// Every message is a fixed event with up to six integer arguments and a
+// printf-style format kept in the event table below, so a hot-path record is
+// just a timestamp, an event id and the raw arguments.  Records are either
+// formatted to stdout immediately (default) or pushed into a lock-free ring
+// that a background thread drains to a binary file; openddr_log_fmt turns
+// that file back into text.
+//
+// Events above OPENDDR_LOG_MAX_LEVEL are compiled out entirely; the rest are
+// filtered at runtime by level and category mask.
+//
+// This header does not depend on SystemC.  The OPENDDR_LOG() macro takes its
+// timestamp from OPENDDR_LOG_TIMESTAMP(), which defaults to the SystemC
+// kernel time in resolution units (ps unless changed).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OpenDDRLog {
+
+enum Level : uint8_t {
+    LVL_ERROR = 0,
+    LVL_WARN  = 1,
+    LVL_INFO  = 2,
+    LVL_DEBUG = 3,
+    LVL_TRACE = 4
+};
+
+enum Category : uint8_t {
+    CAT_AXI = 0,
+    CAT_APB,
+    CAT_SCHED,
+    CAT_DFI,
+    CAT_MEM,
+    CAT_REFRESH,
+    CAT_STATS,
+    CAT_COUNT
+};
+
+// Event table: name, level, category, format (arguments are uint64_t)
+#define OPENDDR_LOG_EVENTS(X) \
+    X(AXI_WRITE_ADDR,      LVL_DEBUG, CAT_AXI,     "AXI Write Addr: ID=%llx Addr=0x%llx Len=%llu Size=%llu") \
+    X(AXI_WRITE_DATA,      LVL_DEBUG, CAT_AXI,     "AXI Write Data: Data=0x%llx Strb=0x%llx Last=%llu") \
+    X(AXI_WRITE_RESP,      LVL_DEBUG, CAT_AXI,     "AXI Write Resp: ID=%llx Resp=%llu") \
+    X(AXI_READ_ADDR,       LVL_DEBUG, CAT_AXI,     "AXI Read Addr: ID=%llx Addr=0x%llx Len=%llu Size=%llu") \
+    X(AXI_READ_DATA,       LVL_DEBUG, CAT_AXI,     "AXI Read Data: ID=%llx Data=0x%llx Last=%llu Resp=%llu") \
+    X(AXI_BRIDGE_MSG,      LVL_DEBUG, CAT_AXI,     "Bridge message: Type=%llu Txn=%llu Length=%llu") \
+    X(AXI_BRIDGE_WRITE,    LVL_DEBUG, CAT_AXI,     "Bridge direct write: Addr=0x%llx Data=0x%llx") \
+    X(APB_WRITE,           LVL_INFO,  CAT_APB,     "APB Write: Addr=0x%llx Data=0x%llx") \
+    X(APB_READ,            LVL_DEBUG, CAT_APB,     "APB Read: Addr=0x%llx Data=0x%llx") \
+    X(SCHED_CMD,           LVL_DEBUG, CAT_SCHED,   "DDR Cmd Scheduled: Type=%llu Rank=%llu Bank=%llu Row=0x%llx Col=0x%llx") \
+    X(SCHED_QUEUE_HIGH,    LVL_INFO,  CAT_SCHED,   "High queue usage - WR_Q=%llu RD_Q=%llu (threshold=%llu)") \
+    X(SCHED_QUEUE_NORMAL,  LVL_INFO,  CAT_SCHED,   "Queue usage normalized - WR_Q=%llu RD_Q=%llu") \
+    X(DFI_CMD,             LVL_DEBUG, CAT_DFI,     "DDR Cmd Executed: Type=%llu Rank=%llu Bank=%llu Row=0x%llx Col=0x%llx") \
+    X(DFI_ACTIVATE,        LVL_DEBUG, CAT_DFI,     "DDR Command: ACTIVATE Bank=%llu Row=0x%llx") \
+    X(DFI_READ,            LVL_DEBUG, CAT_DFI,     "DDR Command: READ Bank=%llu Col=0x%llx") \
+    X(DFI_WRITE,           LVL_DEBUG, CAT_DFI,     "DDR Command: WRITE Bank=%llu Col=0x%llx") \
+    X(DFI_PRECHARGE,       LVL_DEBUG, CAT_DFI,     "DDR Command: PRECHARGE Bank=%llu") \
+    X(DFI_REFRESH,         LVL_DEBUG, CAT_DFI,     "DDR Command: REFRESH") \
+    X(DFI_NOP,             LVL_TRACE, CAT_DFI,     "DDR Command: NOP") \
+    X(MEM_WRITE,           LVL_DEBUG, CAT_MEM,     "Memory Write: Addr=0x%llx Data=0x%llx Strb=0x%llx Block=0x%llx Offset=%llu") \
+    X(MEM_READ,            LVL_DEBUG, CAT_MEM,     "Memory Read: Addr=0x%llx Data=0x%llx Block=0x%llx Offset=%llu Initialized=%llu") \
+    X(MEM_READ_UNINIT,     LVL_DEBUG, CAT_MEM,     "Memory Read (uninitialized): Addr=0x%llx Pattern=0x%llx") \
+    X(REFRESH_SCHEDULED,   LVL_DEBUG, CAT_REFRESH, "Refresh scheduled, pending=%llu") \
+    X(REFRESH_SKIPPED,     LVL_WARN,  CAT_REFRESH, "Refresh skipped - too many pending (%llu)") \
+    X(STATS_PERIODIC,      LVL_INFO,  CAT_STATS,   "Periodic Stats: WR=%llu RD=%llu WR_Q=%llu RD_Q=%llu") \
+    X(LOG_DROPPED,         LVL_WARN,  CAT_STATS,   "Log ring overflow: %llu records dropped") \
+    X(CKPT_SAVED,          LVL_INFO,  CAT_STATS,   "Checkpoint saved: Cycle=%llu Blocks=%llu") \
+    X(CKPT_RESTORED,       LVL_INFO,  CAT_STATS,   "Checkpoint restored: Cycle=%llu Blocks=%llu") \
+    X(AXI_BRIDGE_TIMED,    LVL_DEBUG, CAT_AXI,     "Bridge timed access: Write=%llu Addr=0x%llx Resp=%llu Latency=%llups")
+
+enum EventId : uint16_t {
+#define OPENDDR_LOG_ENUM(name, level, cat, fmt) EV_##name,
+    OPENDDR_LOG_EVENTS(OPENDDR_LOG_ENUM)
+#undef OPENDDR_LOG_ENUM
+    EV_COUNT
+};
+
+struct EventInfo {
+    const char* name;
+    Level level;
+    Category category;
+    const char* format;
+};
+
+inline constexpr EventInfo EVENT_TABLE[EV_COUNT] = {
+#define OPENDDR_LOG_INFO(name, level, cat, fmt) { #name, level, cat, fmt },
+    OPENDDR_LOG_EVENTS(OPENDDR_LOG_INFO)
+#undef OPENDDR_LOG_INFO
+};
+
+static constexpr int MAX_ARGS = 6;
+
+// One binary log record (64 bytes, also the on-disk format)
+struct Record {
+    uint64_t timestamp;
+    uint16_t event;
+    uint8_t nargs;
+    uint8_t reserved[5];
+    uint64_t args[MAX_ARGS];
+};
+static_assert(sizeof(Record) == 64, "log record must stay one cache line");
+
+// Binary file header
+struct FileHeader {
+    char magic[8];           // "ODDRLOG"
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t tick_fs;        // Femtoseconds per timestamp tick
+    uint64_t reserved;
+} __attribute__((packed));
+
+static constexpr char FILE_MAGIC[8] = "ODDRLOG";
+static constexpr uint32_t FILE_VERSION = 1;
+
+// Runtime filter state (read on every enabled-at-compile-time call site)
+extern std::atomic<uint8_t> g_level;
+extern std::atomic<uint32_t> g_category_mask;
+
+inline const char* level_name(Level level) {
+    static const char* names[] = { "ERROR", "WARN", "INFO", "DEBUG", "TRACE" };
+    return level <= LVL_TRACE ? names[level] : "?";
+}
+
+inline const char* category_name(Category cat) {
+    static const char* names[] = { "AXI", "APB", "SCHED", "DFI", "MEM", "REFRESH", "STATS" };
+    return cat < CAT_COUNT ? names[cat] : "?";
+}
+
+// Runtime configuration
+void set_level(Level level);
+void set_categories(uint32_t mask);
+bool parse_level(const std::string& text, Level& level);
+bool parse_categories(const std::string& text, uint32_t& mask);
+
+// OPENDDR_LOG_LEVEL, OPENDDR_LOG_CATEGORIES and OPENDDR_LOG_FILE
+void configure_from_env();
+
+// Binary sink: ring capacity is rounded up to a power of two
+bool start_binary_sink(const std::string& path, size_t ring_capacity = 1 << 16,
+                       uint64_t tick_fs = 1000);
+void stop_binary_sink();
+bool binary_sink_active();
+uint64_t dropped_records();
+
+// Format one record as "@<time> [LEVEL] [CAT] message"
+size_t format_record(const Record& rec, uint64_t tick_fs, char* buf, size_t len);
+
+void emit(EventId ev, uint64_t timestamp, const uint64_t* args, int nargs);
+
+inline bool event_enabled(EventId ev) {
+    const EventInfo& info = EVENT_TABLE[ev];
+    return info.level <= g_level.load(std::memory_order_relaxed) &&
+           (g_category_mask.load(std::memory_order_relaxed) & (1u << info.category));
+}
+
+template <typename... Args>
+inline void write(EventId ev, uint64_t timestamp, Args... args) {
+    static_assert(sizeof...(Args) <= MAX_ARGS, "too many log arguments");
+    const uint64_t packed[sizeof...(Args) + 1] = { static_cast<uint64_t>(args)..., 0 };
+    emit(ev, timestamp, packed, static_cast<int>(sizeof...(Args)));
+}
+
+} // namespace OpenDDRLog
+
+#ifndef OPENDDR_LOG_MAX_LEVEL
+#define OPENDDR_LOG_MAX_LEVEL 3  // LVL_DEBUG; TRACE events are compiled out
+#endif
+
+#ifndef OPENDDR_LOG_TIMESTAMP
+#define OPENDDR_LOG_TIMESTAMP() (sc_time_stamp().value())
+#endif
+
+// OPENDDR_LOG(EVENT, args...): EVENT is an entry of OPENDDR_LOG_EVENTS
+// without the EV_ prefix.  Arguments are not evaluated unless the event is
+// both compiled in and enabled.
+#define OPENDDR_LOG(ev, ...) \
+    do { \
+        if constexpr (OpenDDRLog::EVENT_TABLE[OpenDDRLog::EV_##ev].level <= OPENDDR_LOG_MAX_LEVEL) { \
+            if (OpenDDRLog::event_enabled(OpenDDRLog::EV_##ev)) { \
+                OpenDDRLog::write(OpenDDRLog::EV_##ev, OPENDDR_LOG_TIMESTAMP(), ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#endif // OPENDDR_LOG_H
@@ -0,0 +1,102 @@
+// Formatter for OpenDDR binary log files (see openddr_log.h)
+//
+// Usage: openddr_log_fmt [-l LEVEL] [-c CATEGORIES] FILE
+#include "openddr_log.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <getopt.h>
+
+static void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS] LOGFILE" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Convert an OpenDDR binary log to text." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  -l, --level LEVEL        Maximum level to print: error, warn, info, debug, trace (default: trace)" << std::endl;
+    std::cout << "  -c, --categories LIST    Comma separated categories, e.g. axi,mem (default: all)" << std::endl;
+    std::cout << "  -h, --help               Show this help" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    OpenDDRLog::Level max_level = OpenDDRLog::LVL_TRACE;
+    uint32_t category_mask = (1u << OpenDDRLog::CAT_COUNT) - 1;
+
+    static struct option long_options[] = {
+        {"level",      required_argument, 0, 'l'},
+        {"categories", required_argument, 0, 'c'},
+        {"help",       no_argument,       0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "l:c:h", long_options, nullptr)) != -1) {
+        switch (c) {
+            case 'l':
+                if (!OpenDDRLog::parse_level(optarg, max_level)) {
+                    std::cerr << "Error: Invalid level: " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+
+            case 'c':
+                if (!OpenDDRLog::parse_categories(optarg, category_mask)) {
+                    std::cerr << "Error: Invalid category list: " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind >= argc) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    FILE* fp = fopen(argv[optind], "rb");
+    if (fp == nullptr) {
+        std::cerr << "Error: Cannot open " << argv[optind] << std::endl;
+        return 1;
+    }
+
+    OpenDDRLog::FileHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, OpenDDRLog::FILE_MAGIC, sizeof(header.magic)) != 0) {
+        std::cerr << "Error: " << argv[optind] << " is not an OpenDDR binary log" << std::endl;
+        fclose(fp);
+        return 1;
+    }
+    if (header.version != OpenDDRLog::FILE_VERSION || header.record_size != sizeof(OpenDDRLog::Record)) {
+        std::cerr << "Error: Unsupported log version " << header.version
+                  << " (record size " << header.record_size << ")" << std::endl;
+        fclose(fp);
+        return 1;
+    }
+
+    OpenDDRLog::Record rec;
+    char line[256];
+    uint64_t count = 0;
+    while (fread(&rec, sizeof(rec), 1, fp) == 1) {
+        if (rec.event < OpenDDRLog::EV_COUNT) {
+            const OpenDDRLog::EventInfo& info = OpenDDRLog::EVENT_TABLE[rec.event];
+            if (info.level > max_level || !(category_mask & (1u << info.category))) {
+                continue;
+            }
+        }
+        OpenDDRLog::format_record(rec, header.tick_fs, line, sizeof(line));
+        puts(line);
+        count++;
+    }
+
+    fclose(fp);
+    std::cerr << count << " records" << std::endl;
+    return 0;
+}
@@ -0,0 +1,220 @@
+#ifndef OPENDDR_MEMORY_STORE_H
+#define OPENDDR_MEMORY_STORE_H
+
+// Backing stores for OpenDDRController (the Store policy).
+//
+// A store keeps the contents the model returns on AXI reads.  read() returns
+// false for locations that were never written; the controller then supplies
+// its data pattern instead.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+static const uint32_t MEMORY_BLOCK_SIZE = 4096; // 4KB blocks
+
+// Block contents as 64-bit words, byte 0 of the block in the low byte of
+// word 0.  Words are atomic so that concurrent accesses are well defined.
+struct MemoryBlock {
+    static constexpr uint32_t WORDS = MEMORY_BLOCK_SIZE / 8;
+    std::atomic<uint64_t> words[WORDS];
+
+    MemoryBlock() {
+        for (auto& word : words) {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Sparse store: 4KB blocks allocated on first write.
+//
+// Safe to use from the simulation thread and the bridge's socket threads at
+// once.  Blocks hang off a two-level page table of atomic pointers; a
+// missing table or block is installed with one compare-and-swap, and a
+// thread that loses the race frees its copy.  Nothing is unlinked until
+// clear(), so a lookup is two acquire loads and readers never write shared
+// memory.  A write stores whole words (a compare-and-swap loop for partial
+// strobes), so writes to different blocks proceed in parallel.
+//
+// clear() and restore_block() are for checkpoint restore and must not run
+// concurrently with other accesses.
+class SparseBlockStore {
+public:
+    static const uint64_t MEMORY_SIZE = 1ULL << 30; // 1GB
+    static constexpr unsigned ADDRESS_BITS = 40;    // Width of the model's AXI addresses
+
+    SparseBlockStore() : directory(new std::atomic<Table*>[TABLES]) {
+        for (uint32_t i = 0; i < TABLES; i++) {
+            directory[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~SparseBlockStore() { clear(); }
+    SparseBlockStore(const SparseBlockStore&) = delete;
+    SparseBlockStore& operator=(const SparseBlockStore&) = delete;
+
+    void write(uint64_t addr, uint64_t data, uint8_t strb) {
+        MemoryBlock* block = install(install(directory[table_index(addr)])->blocks[block_index(addr)]);
+
+        // Byte i of data goes to block offset + i; an unaligned access spans
+        // two words, and bytes past the end of the block are dropped
+        uint32_t offset = addr & (MEMORY_BLOCK_SIZE - 1);
+        uint32_t word = offset / 8;
+        uint32_t shift = (offset % 8) * 8;
+        uint64_t mask = 0;
+        for (int i = 0; i < 8; i++) {
+            if (strb & (1 << i)) {
+                mask |= 0xFFULL << (i * 8);
+            }
+        }
+        store_bytes(block->words[word], data << shift, mask << shift);
+        if (shift != 0 && word + 1 < MemoryBlock::WORDS) {
+            store_bytes(block->words[word + 1], data >> (64 - shift), mask >> (64 - shift));
+        }
+    }
+
+    bool read(uint64_t addr, uint64_t& data) const {
+        const Table* table = directory[table_index(addr)].load(std::memory_order_acquire);
+        const MemoryBlock* block =
+            table ? table->blocks[block_index(addr)].load(std::memory_order_acquire) : nullptr;
+        if (block == nullptr) {
+            return false;
+        }
+
+        uint32_t offset = addr & (MEMORY_BLOCK_SIZE - 1);
+        uint32_t word = offset / 8;
+        uint32_t shift = (offset % 8) * 8;
+        data = block->words[word].load(std::memory_order_relaxed) >> shift;
+        if (shift != 0 && word + 1 < MemoryBlock::WORDS) {
+            data |= block->words[word + 1].load(std::memory_order_relaxed) << (64 - shift);
+        }
+        return true;
+    }
+
+    void clear() {
+        for (uint32_t t = 0; t < TABLES; t++) {
+            Table* table = directory[t].exchange(nullptr, std::memory_order_acq_rel);
+            if (table == nullptr) {
+                continue;
+            }
+            for (auto& slot : table->blocks) {
+                delete slot.load(std::memory_order_relaxed);
+            }
+            delete table;
+        }
+    }
+
+    // Checkpoint support: visit every allocated block in address order with
+    // a snapshot of its bytes (valid during the call only), or restore one
+    template <class F>
+    void for_each_block(F f) const {
+        uint8_t bytes[MEMORY_BLOCK_SIZE];
+        for (uint32_t t = 0; t < TABLES; t++) {
+            const Table* table = directory[t].load(std::memory_order_acquire);
+            if (table == nullptr) {
+                continue;
+            }
+            for (uint32_t b = 0; b < TABLE_SIZE; b++) {
+                const MemoryBlock* block = table->blocks[b].load(std::memory_order_acquire);
+                if (block == nullptr) {
+                    continue;
+                }
+                for (uint32_t w = 0; w < MemoryBlock::WORDS; w++) {
+                    uint64_t word = block->words[w].load(std::memory_order_relaxed);
+                    for (int i = 0; i < 8; i++) {
+                        bytes[w * 8 + i] = static_cast<uint8_t>(word >> (i * 8));
+                    }
+                }
+                f((static_cast<uint64_t>(t) * TABLE_SIZE + b) * MEMORY_BLOCK_SIZE, bytes);
+            }
+        }
+    }
+
+    void restore_block(uint64_t block_addr, const uint8_t* bytes) {
+        MemoryBlock* block =
+            install(install(directory[table_index(block_addr)])->blocks[block_index(block_addr)]);
+        for (uint32_t w = 0; w < MemoryBlock::WORDS; w++) {
+            uint64_t word = 0;
+            for (int i = 0; i < 8; i++) {
+                word |= static_cast<uint64_t>(bytes[w * 8 + i]) << (i * 8);
+            }
+            block->words[w].store(word, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    // Block number = directory index : table index, 14 bits each for 40-bit
+    // addresses; a table covers 64MB
+    static constexpr unsigned TABLE_BITS = 14;
+    static constexpr uint32_t TABLE_SIZE = 1u << TABLE_BITS;
+    static constexpr uint32_t TABLES = 1u << (ADDRESS_BITS - 12 - TABLE_BITS);
+    static_assert(MEMORY_BLOCK_SIZE == 1u << 12, "page table assumes 4KB blocks");
+
+    struct Table {
+        std::atomic<MemoryBlock*> blocks[TABLE_SIZE];
+
+        Table() {
+            for (auto& slot : blocks) {
+                slot.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    static uint32_t table_index(uint64_t addr) {
+        return static_cast<uint32_t>(addr >> (12 + TABLE_BITS)) & (TABLES - 1);
+    }
+    static uint32_t block_index(uint64_t addr) {
+        return static_cast<uint32_t>(addr >> 12) & (TABLE_SIZE - 1);
+    }
+
+    // The entry in slot, allocating it if this thread gets there first
+    template <typename T>
+    static T* install(std::atomic<T*>& slot) {
+        T* current = slot.load(std::memory_order_acquire);
+        if (current != nullptr) {
+            return current;
+        }
+        T* fresh = new T();
+        if (slot.compare_exchange_strong(current, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return fresh;
+        }
+        delete fresh;
+        return current;
+    }
+
+    // Replaces the bytes of word selected by mask
+    static void store_bytes(std::atomic<uint64_t>& word, uint64_t data, uint64_t mask) {
+        if (mask == ~0ULL) {
+            word.store(data, std::memory_order_relaxed);
+            return;
+        }
+        if (mask == 0) {
+            return;
+        }
+        uint64_t old = word.load(std::memory_order_relaxed);
+        while (!word.compare_exchange_weak(old, (old & ~mask) | (data & mask), std::memory_order_relaxed)) {
+        }
+    }
+
+    std::unique_ptr<std::atomic<Table*>[]> directory;
+};
+
+// Stateless store of the basic model: writes are dropped and every read
+// returns an address-derived pattern
+class AddressPatternStore {
+public:
+    void write(uint64_t, uint64_t, uint8_t) {}
+
+    bool read(uint64_t addr, uint64_t& data) {
+        data = addr ^ 0xDEADBEEF;
+        return true;
+    }
+
+    void clear() {}
+
+    template <class F>
+    void for_each_block(F) const {}
+
+    void restore_block(uint64_t, const uint8_t*) {}
+};
+
+#endif // OPENDDR_MEMORY_STORE_H
@@ -0,0 +1,51 @@
+#ifndef OPENDDR_MODEL_CONFIG_H
+#define OPENDDR_MODEL_CONFIG_H
+
+#include <cstdint>
+#include <cstring>
+
+// Construction-time configuration for the OpenDDR models.  Queue depths are
+// rounded up to a power of two by RingBuffer; a full queue back-pressures
+// the AXI channel or the scheduler feeding it.
+struct ModelConfig {
+    // AXI transaction queues
+    uint32_t write_addr_queue_depth = 64;
+    uint32_t write_data_queue_depth = 16;
+    uint32_t write_resp_queue_depth = 64;
+    uint32_t read_addr_queue_depth = 64;
+    uint32_t read_resp_queue_depth = 64;
+
+    // DDR command queue; a page-miss write or read needs two entries
+    uint32_t ddr_cmd_queue_depth = 128;
+
+    // Set a field by name (as given to the testbenches' --set key=value);
+    // returns false for an unknown key
+    bool set(const char* key, uint32_t value) {
+        struct Field { const char* name; uint32_t ModelConfig::*member; };
+        static const Field fields[] = {
+            {"write_addr_queue_depth", &ModelConfig::write_addr_queue_depth},
+            {"write_data_queue_depth", &ModelConfig::write_data_queue_depth},
+            {"write_resp_queue_depth", &ModelConfig::write_resp_queue_depth},
+            {"read_addr_queue_depth",  &ModelConfig::read_addr_queue_depth},
+            {"read_resp_queue_depth",  &ModelConfig::read_resp_queue_depth},
+            {"ddr_cmd_queue_depth",    &ModelConfig::ddr_cmd_queue_depth},
+        };
+        for (const Field& f : fields) {
+            if (strcmp(key, f.name) == 0) {
+                this->*f.member = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Queue depths of the basic OpenDDRSystemCModel
+    static ModelConfig basic() {
+        ModelConfig cfg;
+        cfg.write_addr_queue_depth = 16;
+        cfg.read_addr_queue_depth = 16;
+        return cfg;
+    }
+};
+
+#endif // OPENDDR_MODEL_CONFIG_H
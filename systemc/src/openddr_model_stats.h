@@ -0,0 +1,82 @@
+#ifndef OPENDDR_MODEL_STATS_H
+#define OPENDDR_MODEL_STATS_H
+
+// Snapshot of a model's counters, taken with OpenDDRController::statistics().
+// write_json() emits one flat object of numbers, which is what the
+// testbenches' --stats-json writes and openddr_sweep collects per point.
+
+#include <cstdint>
+#include <ostream>
+
+struct ModelStatistics {
+    uint64_t total_write_transactions = 0;
+    uint64_t total_read_transactions = 0;
+    uint64_t total_ddr_commands = 0;
+    uint64_t page_hits = 0;
+    uint64_t page_misses = 0;
+    uint64_t page_conflicts = 0;         // Misses with another row open in the bank
+    uint64_t data_errors = 0;
+    uint64_t address_errors = 0;
+    uint64_t timing_violations = 0;
+
+    // Queue high-water marks
+    uint64_t write_addr_queue_hwm = 0;
+    uint64_t write_data_queue_hwm = 0;
+    uint64_t write_resp_queue_hwm = 0;
+    uint64_t read_addr_queue_hwm = 0;
+    uint64_t read_resp_queue_hwm = 0;
+    uint64_t ddr_cmd_queue_hwm = 0;
+
+    // Current queue occupancy, for live monitoring (not in write_json)
+    uint64_t write_addr_queue_depth = 0;
+    uint64_t write_data_queue_depth = 0;
+    uint64_t write_resp_queue_depth = 0;
+    uint64_t read_addr_queue_depth = 0;
+    uint64_t read_resp_queue_depth = 0;
+    uint64_t ddr_cmd_queue_depth = 0;
+
+    // Banks: column accesses each, and how many have a row open now
+    static constexpr int BANKS = 16;
+    uint64_t bank_accesses[BANKS] = {};
+    uint64_t open_banks = 0;
+
+    // Filled in by the testbench
+    uint64_t seed = 0;
+    double sim_time_ns = 0.0;
+    double wall_seconds = 0.0;
+
+    double page_hit_rate() const {
+        uint64_t accesses = page_hits + page_misses;
+        return accesses ? static_cast<double>(page_hits) / accesses : 0.0;
+    }
+
+    void write_json(std::ostream& os) const {
+        os << "{\n"
+           << "  \"total_write_transactions\": " << total_write_transactions << ",\n"
+           << "  \"total_read_transactions\": " << total_read_transactions << ",\n"
+           << "  \"total_ddr_commands\": " << total_ddr_commands << ",\n"
+           << "  \"page_hits\": " << page_hits << ",\n"
+           << "  \"page_misses\": " << page_misses << ",\n"
+           << "  \"page_conflicts\": " << page_conflicts << ",\n"
+           << "  \"page_hit_rate\": " << page_hit_rate() << ",\n"
+           << "  \"data_errors\": " << data_errors << ",\n"
+           << "  \"address_errors\": " << address_errors << ",\n"
+           << "  \"timing_violations\": " << timing_violations << ",\n"
+           << "  \"write_addr_queue_hwm\": " << write_addr_queue_hwm << ",\n"
+           << "  \"write_data_queue_hwm\": " << write_data_queue_hwm << ",\n"
+           << "  \"write_resp_queue_hwm\": " << write_resp_queue_hwm << ",\n"
+           << "  \"read_addr_queue_hwm\": " << read_addr_queue_hwm << ",\n"
+           << "  \"read_resp_queue_hwm\": " << read_resp_queue_hwm << ",\n"
+           << "  \"ddr_cmd_queue_hwm\": " << ddr_cmd_queue_hwm << ",\n";
+        for (int i = 0; i < BANKS; i++) {
+            os << "  \"bank" << i << "_accesses\": " << bank_accesses[i] << ",\n";
+        }
+        os << "  \"open_banks\": " << open_banks << ",\n"
+           << "  \"seed\": " << seed << ",\n"
+           << "  \"sim_time_ns\": " << sim_time_ns << ",\n"
+           << "  \"wall_seconds\": " << wall_seconds << "\n"
+           << "}\n";
+    }
+};
+
+#endif // OPENDDR_MODEL_STATS_H
@@ -0,0 +1,74 @@
+#ifndef OPENDDR_RING_BUFFER_H
+#define OPENDDR_RING_BUFFER_H
+
+// Fixed-capacity FIFO used for the model's transaction and command queues.
+//
+// Storage is allocated once, at construction, with the capacity rounded up
+// to a power of two so that indexing is a mask.  push() never allocates; it
+// fails when the ring is full and the caller applies back-pressure.  The
+// ring also records its occupancy high-water mark for statistics.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class RingBuffer {
+public:
+    explicit RingBuffer(size_t min_capacity = 16) {
+        size_t cap = 1;
+        while (cap < min_capacity) {
+            cap <<= 1;
+        }
+        mask = cap - 1;
+        slots.reset(new T[cap]);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    bool push(const T& value) {
+        if (full()) {
+            return false;
+        }
+        slots[tail & mask] = value;
+        tail++;
+        if (size() > hwm) {
+            hwm = size();
+        }
+        return true;
+    }
+
+    T& front() { return slots[head & mask]; }
+    const T& front() const { return slots[head & mask]; }
+
+    // i-th queued element counted from the front (i < size())
+    const T& at(size_t i) const { return slots[(head + i) & mask]; }
+
+    void pop() {
+        if (!empty()) {
+            head++;
+        }
+    }
+
+    void clear() { head = tail; }
+
+    bool empty() const { return head == tail; }
+    bool full() const { return size() > mask; }
+    size_t size() const { return tail - head; }
+    size_t capacity() const { return mask + 1; }
+    size_t free_slots() const { return capacity() - size(); }
+
+    // Highest occupancy seen since construction or the last reset
+    size_t high_water() const { return hwm; }
+    void reset_high_water() { hwm = size(); }
+
+private:
+    std::unique_ptr<T[]> slots;
+    size_t mask;
+    size_t head = 0;
+    size_t tail = 0;
+    size_t hwm = 0;
+};
+
+#endif // OPENDDR_RING_BUFFER_H
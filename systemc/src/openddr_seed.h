@@ -0,0 +1,79 @@
+#ifndef OPENDDR_SEED_H
+#define OPENDDR_SEED_H
+
+// Global seed for every random stream in the OpenDDR models, testbenches and
+// bridge tools.
+//
+// One 64-bit global seed is set per process (--seed, or OPENDDR_SEED in the
+// environment); each component derives its own stream from it by name, e.g.
+// the model's hierarchical name or "test_client.basic".  Streams are
+// therefore independent of each other and of construction order, and two runs
+// with the same seed and configuration produce identical results.  Without a
+// seed, DEFAULT_SEED is used, so runs are reproducible by default.
+//
+// This header does not depend on SystemC.
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+namespace OpenDDRSeed {
+
+static constexpr uint64_t DEFAULT_SEED = 0x0DD5EEDULL;
+
+inline uint64_t& global_seed() {
+    static uint64_t seed = DEFAULT_SEED;
+    return seed;
+}
+
+inline void set_global(uint64_t seed) { global_seed() = seed; }
+inline uint64_t global() { return global_seed(); }
+
+// splitmix64 step: advances state and returns the next output
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Seed of the stream called name under the global seed
+inline uint64_t derive(const char* name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;  // FNV-1a of the name
+    for (const char* p = name; *p; p++) {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 0x100000001b3ULL;
+    }
+    uint64_t state = global() ^ hash;
+    return splitmix64(state);
+}
+
+// A generator for the stream called name, seeded with all 64 bits
+inline std::mt19937 rng(const char* name) {
+    uint64_t seed = derive(name);
+    std::seed_seq seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    return std::mt19937(seq);
+}
+
+// Parses a seed (decimal or 0x hex)
+inline bool parse(const char* text, uint64_t& seed) {
+    char* end;
+    seed = strtoull(text, &end, 0);
+    return *text != '\0' && *end == '\0';
+}
+
+// Applies OPENDDR_SEED if set; a --seed option given later overrides it
+inline void configure_from_env() {
+    if (const char* env = std::getenv("OPENDDR_SEED")) {
+        uint64_t seed;
+        if (parse(env, seed)) {
+            set_global(seed);
+        } else {
+            std::cerr << "Ignoring invalid OPENDDR_SEED: " << env << std::endl;
+        }
+    }
+}
+
+} // namespace OpenDDRSeed
+
+#endif // OPENDDR_SEED_H
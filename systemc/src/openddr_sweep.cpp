@@ -0,0 +1,469 @@
+// Parallel parameter sweep driver for the OpenDDR SystemC model
+//
+// Usage: openddr_sweep [OPTIONS] GRIDFILE [-- MODEL_ARGS...]
+//
+// The grid file names one parameter per line; the sweep runs every point of
+// their cartesian product.  Each point is a separate model process (one
+// SystemC kernel each), started in its own directory and pinned to one CPU;
+// up to one worker per allowed CPU runs at a time.  When a point finishes its
+// --stats-json output is collected, and all points are written to one CSV or
+// JSON file.
+//
+// Grid file syntax ('#' starts a comment):
+//   ddr_cmd_queue_depth = 32, 64, 128     ModelConfig field  -> --set
+//   write_addr_queue_depth = 8:64:8       inclusive range START:STOP[:STEP]
+//   reg.0x020 = 0x0C0C0C0C, 0x10101010    APB register       -> --reg
+//   sim_time = 20000                      simulated ns       -> --sim-time
+//   seed = 1:8                            global seed        -> --seed
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <getopt.h>
+#include <limits.h>
+#include <sched.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct SweepParam {
+    std::string name;
+    std::vector<std::string> values;
+};
+
+struct PointResult {
+    int exit_code = -1;
+    std::vector<std::pair<std::string, std::string>> stats;
+};
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_interrupt(int) {
+    interrupted = 1;
+}
+
+static void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS] GRIDFILE [-- MODEL_ARGS...]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Run the OpenDDR model once per point of a parameter grid, in parallel." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  -m, --model PATH         Model executable (default: ./openddr_simulation_enhanced)" << std::endl;
+    std::cout << "  -j, --jobs N             Parallel workers (default: one per allowed CPU)" << std::endl;
+    std::cout << "  -o, --output FILE        Results file; .json for JSON, otherwise CSV (default: sweep_results.csv)" << std::endl;
+    std::cout << "  -w, --workdir DIR        Per-point run directories (default: sweep_runs)" << std::endl;
+    std::cout << "  -n, --dry-run            Print the model command lines and exit" << std::endl;
+    std::cout << "  -h, --help               Show this help" << std::endl;
+}
+
+static std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) {
+        return "";
+    }
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+// Expands one value item; START:STOP[:STEP] becomes an inclusive range
+static bool expand_item(const std::string& item, std::vector<std::string>& out) {
+    if (item.find(':') == std::string::npos) {
+        out.push_back(item);
+        return true;
+    }
+    long long start, stop, step = 1;
+    char extra;
+    int n = sscanf(item.c_str(), "%lli:%lli:%lli%c", &start, &stop, &step, &extra);
+    if (n < 2 || n > 3 || step <= 0 || stop < start) {
+        return false;
+    }
+    for (long long v = start; v <= stop; v += step) {
+        out.push_back(std::to_string(v));
+    }
+    return true;
+}
+
+static bool parse_grid(const char* path, std::vector<SweepParam>& params) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Error: Cannot open " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    int line_no = 0;
+    while (std::getline(in, line)) {
+        line_no++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+        size_t eq = line.find('=');
+        SweepParam param;
+        param.name = trim(line.substr(0, eq));
+        if (eq == std::string::npos || param.name.empty()) {
+            std::cerr << "Error: " << path << ":" << line_no << ": expected NAME = VALUES" << std::endl;
+            return false;
+        }
+        std::string values = line.substr(eq + 1);
+        std::replace(values.begin(), values.end(), ',', ' ');
+        std::istringstream items(values);
+        std::string item;
+        while (items >> item) {
+            if (!expand_item(item, param.values)) {
+                std::cerr << "Error: " << path << ":" << line_no << ": bad range " << item << std::endl;
+                return false;
+            }
+        }
+        if (param.values.empty()) {
+            std::cerr << "Error: " << path << ":" << line_no << ": no values for " << param.name << std::endl;
+            return false;
+        }
+        params.push_back(param);
+    }
+    return true;
+}
+
+// Value index of each parameter at a point (first parameter varies slowest)
+static std::vector<size_t> point_indices(const std::vector<SweepParam>& params, size_t point) {
+    std::vector<size_t> idx(params.size());
+    for (size_t i = params.size(); i-- > 0;) {
+        idx[i] = point % params[i].values.size();
+        point /= params[i].values.size();
+    }
+    return idx;
+}
+
+static std::vector<std::string> model_args(const std::string& model, const std::vector<SweepParam>& params,
+                                           size_t point, const std::vector<std::string>& extra) {
+    std::vector<std::string> args = {model, "--no-vcd", "--stats-json", "stats.json"};
+    std::vector<size_t> idx = point_indices(params, point);
+    for (size_t i = 0; i < params.size(); i++) {
+        const std::string& name = params[i].name;
+        const std::string& value = params[i].values[idx[i]];
+        if (name == "sim_time") {
+            args.push_back("--sim-time");
+            args.push_back(value);
+        } else if (name == "seed") {
+            args.push_back("--seed");
+            args.push_back(value);
+        } else if (name.compare(0, 4, "reg.") == 0) {
+            args.push_back("--reg");
+            args.push_back(name.substr(4) + "=" + value);
+        } else {
+            args.push_back("--set");
+            args.push_back(name + "=" + value);
+        }
+    }
+    args.insert(args.end(), extra.begin(), extra.end());
+    return args;
+}
+
+static std::string point_dir(const std::string& workdir, size_t point) {
+    char name[32];
+    snprintf(name, sizeof(name), "/point_%05zu", point);
+    return workdir + name;
+}
+
+// Reads the flat {"key": number, ...} object written by ModelStatistics
+static void read_stats(const std::string& path, std::vector<std::pair<std::string, std::string>>& stats) {
+    std::ifstream in(path);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    size_t pos = 0;
+    while ((pos = text.find('"', pos)) != std::string::npos) {
+        size_t key_end = text.find('"', pos + 1);
+        size_t colon = text.find(':', key_end);
+        if (key_end == std::string::npos || colon == std::string::npos) {
+            break;
+        }
+        size_t value_end = text.find_first_of(",}\n", colon + 1);
+        stats.emplace_back(text.substr(pos + 1, key_end - pos - 1),
+                           trim(text.substr(colon + 1, value_end - colon - 1)));
+        pos = value_end;
+    }
+}
+
+// Child side of a worker: pin, move into the point directory, exec the model
+static void run_worker(int cpu, const std::string& dir, const std::vector<std::string>& args) {
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+    if (chdir(dir.c_str()) != 0) {
+        _exit(126);
+    }
+    int fd = open("model.log", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+    }
+    std::vector<char*> argv;
+    for (const std::string& a : args) {
+        argv.push_back(const_cast<char*>(a.c_str()));
+    }
+    argv.push_back(nullptr);
+    execv(argv[0], argv.data());
+    _exit(127);
+}
+
+static void write_csv(std::ostream& out, const std::vector<SweepParam>& params,
+                      const std::vector<PointResult>& results) {
+    // Stat columns come from the first point that produced statistics
+    const std::vector<std::pair<std::string, std::string>>* columns = nullptr;
+    for (const PointResult& r : results) {
+        if (!r.stats.empty()) {
+            columns = &r.stats;
+            break;
+        }
+    }
+
+    out << "point";
+    for (const SweepParam& p : params) {
+        out << "," << p.name;
+    }
+    out << ",exit_code";
+    if (columns) {
+        for (const auto& kv : *columns) {
+            out << "," << kv.first;
+        }
+    }
+    out << "\n";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        std::vector<size_t> idx = point_indices(params, i);
+        out << i;
+        for (size_t p = 0; p < params.size(); p++) {
+            out << "," << params[p].values[idx[p]];
+        }
+        out << "," << results[i].exit_code;
+        if (columns) {
+            for (const auto& kv : *columns) {
+                std::string value;
+                for (const auto& s : results[i].stats) {
+                    if (s.first == kv.first) {
+                        value = s.second;
+                        break;
+                    }
+                }
+                out << "," << value;
+            }
+        }
+        out << "\n";
+    }
+}
+
+static void write_json(std::ostream& out, const std::vector<SweepParam>& params,
+                       const std::vector<PointResult>& results) {
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        std::vector<size_t> idx = point_indices(params, i);
+        out << "  {\"point\": " << i << ", \"params\": {";
+        for (size_t p = 0; p < params.size(); p++) {
+            out << (p ? ", " : "") << "\"" << params[p].name << "\": \"" << params[p].values[idx[p]] << "\"";
+        }
+        out << "}, \"exit_code\": " << results[i].exit_code << ", \"stats\": {";
+        for (size_t s = 0; s < results[i].stats.size(); s++) {
+            out << (s ? ", " : "") << "\"" << results[i].stats[s].first << "\": " << results[i].stats[s].second;
+        }
+        out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string model = "./openddr_simulation_enhanced";
+    std::string output = "sweep_results.csv";
+    std::string workdir = "sweep_runs";
+    long jobs = 0;
+    bool dry_run = false;
+
+    static struct option long_options[] = {
+        {"model",   required_argument, 0, 'm'},
+        {"jobs",    required_argument, 0, 'j'},
+        {"output",  required_argument, 0, 'o'},
+        {"workdir", required_argument, 0, 'w'},
+        {"dry-run", no_argument,       0, 'n'},
+        {"help",    no_argument,       0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "m:j:o:w:nh", long_options, nullptr)) != -1) {
+        switch (c) {
+            case 'm': model = optarg; break;
+            case 'j': jobs = strtol(optarg, nullptr, 10); break;
+            case 'o': output = optarg; break;
+            case 'w': workdir = optarg; break;
+            case 'n': dry_run = true; break;
+
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind >= argc) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<SweepParam> params;
+    if (!parse_grid(argv[optind], params)) {
+        return 1;
+    }
+    std::vector<std::string> extra(argv + optind + 1, argv + argc);
+
+    size_t total = 1;
+    for (const SweepParam& p : params) {
+        total *= p.values.size();
+    }
+
+    if (dry_run) {
+        for (size_t i = 0; i < total; i++) {
+            for (const std::string& a : model_args(model, params, i, extra)) {
+                std::cout << a << " ";
+            }
+            std::cout << std::endl;
+        }
+        return 0;
+    }
+
+    // Workers run in their own directories, so the model path must be absolute
+    char resolved[PATH_MAX];
+    if (realpath(model.c_str(), resolved) == nullptr || access(resolved, X_OK) != 0) {
+        std::cerr << "Error: Model executable not found: " << model << std::endl;
+        return 1;
+    }
+    model = resolved;
+    if (mkdir(workdir.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Error: Cannot create " << workdir << ": " << strerror(errno) << std::endl;
+        return 1;
+    }
+
+    // One worker slot per CPU this process may run on
+    std::vector<int> cpus;
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    if (jobs <= 0) {
+        jobs = cpus.empty() ? 1 : static_cast<long>(cpus.size());
+    }
+
+    // No SA_RESTART, so Ctrl-C interrupts waitpid and the workers are stopped
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_interrupt;
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    std::cerr << "Sweeping " << total << " points with " << jobs << " workers" << std::endl;
+
+    std::vector<PointResult> results(total);
+    std::vector<pid_t> slot_pid(jobs, 0);
+    std::vector<size_t> slot_point(jobs, 0);
+    size_t next = 0, done = 0;
+    long running = 0;
+
+    while (done < total && !(interrupted && running == 0)) {
+        // Fill idle slots
+        for (long slot = 0; slot < jobs && next < total && !interrupted; slot++) {
+            if (slot_pid[slot] != 0) {
+                continue;
+            }
+            std::string dir = point_dir(workdir, next);
+            mkdir(dir.c_str(), 0755);
+            std::vector<std::string> args = model_args(model, params, next, extra);
+            int cpu = cpus.empty() ? -1 : cpus[slot % cpus.size()];
+            pid_t pid = fork();
+            if (pid < 0) {
+                std::cerr << "Error: fork failed: " << strerror(errno) << std::endl;
+                break;
+            }
+            if (pid == 0) {
+                run_worker(cpu, dir, args);
+            }
+            slot_pid[slot] = pid;
+            slot_point[slot] = next++;
+            running++;
+        }
+
+        if (running == 0) {
+            break;
+        }
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) {
+                if (interrupted) {
+                    for (pid_t p : slot_pid) {
+                        if (p != 0) {
+                            kill(p, SIGTERM);
+                        }
+                    }
+                }
+                continue;
+            }
+            break;
+        }
+
+        for (long slot = 0; slot < jobs; slot++) {
+            if (slot_pid[slot] != pid) {
+                continue;
+            }
+            size_t point = slot_point[slot];
+            PointResult& r = results[point];
+            r.exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            if (r.exit_code == 0) {
+                read_stats(point_dir(workdir, point) + "/stats.json", r.stats);
+            }
+            slot_pid[slot] = 0;
+            running--;
+            done++;
+            std::cerr << "[" << done << "/" << total << "] point " << point
+                      << (r.exit_code == 0 ? " done" : " FAILED (exit " + std::to_string(r.exit_code) + ")")
+                      << std::endl;
+            break;
+        }
+    }
+
+    std::ofstream out(output);
+    if (!out) {
+        std::cerr << "Error: Cannot write " << output << std::endl;
+        return 1;
+    }
+    bool json = output.size() >= 5 && output.compare(output.size() - 5, 5, ".json") == 0;
+    if (json) {
+        write_json(out, params, results);
+    } else {
+        write_csv(out, params, results);
+    }
+    std::cerr << "Results written to " << output << std::endl;
+
+    size_t failed = 0;
+    for (const PointResult& r : results) {
+        failed += (r.exit_code != 0);
+    }
+    return (failed || interrupted) ? 1 : 0;
+}
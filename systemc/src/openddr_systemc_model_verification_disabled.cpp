@@ -1,1060 +1,4 @@
-#include "openddr_systemc_model_enhanced.h"
-#include <iostream>
-#include <iomanip>
-#include <sstream>
+#include "openddr_systemc_model_verification_disabled.h"
+#include "openddr_controller_impl.h"
 
-// AXI Write Address Channel Process
-void openddrSystemCModelEnhanced::axi_write_addr_process() {
-    if (!mc_rst_b.read()) {
-        axi_aw_ready_reg = false;
-        mc0_axi_awready.write(false);
-        // Clear write address queue
-        while (!write_addr_queue.empty()) {
-            write_addr_queue.pop();
-        }
-        return;
-    }
-
-    // Handle AXI write address channel with proper state machine
-    if (mc0_axi_awvalid.read() && !axi_aw_ready_reg) {
-        // Check if we can accept the transaction
-        if (write_addr_queue.size() < 64) { // Increased queue depth for better performance
-            AXITransaction trans;
-            trans.id = mc0_axi_awid.read();
-            trans.addr = mc0_axi_awaddr.read();
-            trans.len = mc0_axi_awlen.read();
-            trans.size = mc0_axi_awsize.read();
-            trans.burst = mc0_axi_awburst.read();
-            trans.is_write = true;
-            trans.timestamp = sc_time_stamp();
-            
-            // Always accept all transactions
-            trans.resp = 0; // OKAY - always accept transactions
-            
-            write_addr_queue.push(trans);
-            axi_aw_ready_reg = true;
-            total_write_transactions++;
-            
-            std::cout << "@" << sc_time_stamp() << " AXI Write Addr: ID=" 
-                      << std::hex << trans.id << " Addr=0x" << trans.addr 
-                      << " Len=" << std::dec << (int)trans.len 
-                      << " Size=" << (int)trans.size << std::endl;
-        }
-    } else {
-        axi_aw_ready_reg = false;
-    }
-    
-    mc0_axi_awready.write(axi_aw_ready_reg);
-}
-
-// AXI Write Data Channel Process
-void openddrSystemCModelEnhanced::axi_write_data_process() {
-    if (!mc_rst_b.read()) {
-        axi_w_ready_reg = false;
-        mc0_axi_wready.write(false);
-        while (!write_data_queue.empty()) {
-            write_data_queue.pop();
-        }
-        return;
-    }
-
-    // Handle AXI write data channel
-    if (mc0_axi_wvalid.read() && !axi_w_ready_reg) {
-        if (write_data_queue.size() < 16) {
-            AXITransaction trans;
-            trans.data = mc0_axi_wdata.read();
-            trans.strb = mc0_axi_wstrb.read();
-            trans.last = mc0_axi_wlast.read();
-            trans.is_write = true;
-            trans.timestamp = sc_time_stamp();
-            
-            write_data_queue.push(trans);
-            axi_w_ready_reg = true;
-            
-            std::cout << "@" << sc_time_stamp() << " AXI Write Data: Data=0x" 
-                      << std::hex << trans.data << " Strb=0x" << (int)trans.strb 
-                      << " Last=" << trans.last << std::endl;
-        }
-    } else {
-        axi_w_ready_reg = false;
-    }
-    
-    mc0_axi_wready.write(axi_w_ready_reg);
-}
-
-// AXI Write Response Channel Process
-void openddrSystemCModelEnhanced::axi_write_resp_process() {
-    if (!mc_rst_b.read()) {
-        axi_b_valid_reg = false;
-        mc0_axi_bvalid.write(false);
-        mc0_axi_bid.write(0);
-        mc0_axi_bresp.write(0);
-        while (!write_resp_queue.empty()) {
-            write_resp_queue.pop();
-        }
-        return;
-    }
-
-    // Generate write responses
-    if (!write_resp_queue.empty() && mc0_axi_bready.read() && !axi_b_valid_reg) {
-        AXITransaction trans = write_resp_queue.front();
-        write_resp_queue.pop();
-        
-        mc0_axi_bid.write(trans.id);
-        mc0_axi_bresp.write(trans.resp);
-        axi_b_valid_reg = true;
-        
-        std::cout << "@" << sc_time_stamp() << " AXI Write Resp: ID=" 
-                  << std::hex << trans.id << " Resp=" << (int)trans.resp << std::endl;
-    } else if (axi_b_valid_reg && mc0_axi_bready.read()) {
-        axi_b_valid_reg = false;
-    }
-    
-    mc0_axi_bvalid.write(axi_b_valid_reg);
-}
-
-// AXI Read Address Channel Process
-void openddrSystemCModelEnhanced::axi_read_addr_process() {
-    if (!mc_rst_b.read()) {
-        axi_ar_ready_reg = false;
-        mc0_axi_arready.write(false);
-        while (!read_addr_queue.empty()) {
-            read_addr_queue.pop();
-        }
-        return;
-    }
-
-    // Handle AXI read address channel
-    if (mc0_axi_arvalid.read() && !axi_ar_ready_reg) {
-        if (read_addr_queue.size() < 64) {
-            AXITransaction trans;
-            trans.id = mc0_axi_arid.read();
-            trans.addr = mc0_axi_araddr.read();
-            trans.len = mc0_axi_arlen.read();
-            trans.size = mc0_axi_arsize.read();
-            trans.burst = mc0_axi_arburst.read();
-            trans.is_write = false;
-            trans.timestamp = sc_time_stamp();
-            
-            // Always accept all transactions
-            trans.resp = 0; // OKAY - always accept transactions
-            
-            read_addr_queue.push(trans);
-            axi_ar_ready_reg = true;
-            total_read_transactions++;
-            
-            std::cout << "@" << sc_time_stamp() << " AXI Read Addr: ID=" 
-                      << std::hex << trans.id << " Addr=0x" << trans.addr 
-                      << " Len=" << std::dec << (int)trans.len 
-                      << " Size=" << (int)trans.size << std::endl;
-        }
-    } else {
-        axi_ar_ready_reg = false;
-    }
-    
-    mc0_axi_arready.write(axi_ar_ready_reg);
-}
-
-// AXI Read Data Channel Process
-void openddrSystemCModelEnhanced::axi_read_data_process() {
-    if (!mc_rst_b.read()) {
-        axi_r_valid_reg = false;
-        mc0_axi_rvalid.write(false);
-        mc0_axi_rid.write(0);
-        mc0_axi_rdata.write(0);
-        mc0_axi_rresp.write(0);
-        mc0_axi_rlast.write(false);
-        while (!read_resp_queue.empty()) {
-            read_resp_queue.pop();
-        }
-        return;
-    }
-
-    // Generate read responses
-    if (!read_resp_queue.empty() && mc0_axi_rready.read() && !axi_r_valid_reg) {
-        AXITransaction trans = read_resp_queue.front();
-        read_resp_queue.pop();
-        
-        mc0_axi_rid.write(trans.id);
-        mc0_axi_rdata.write(trans.data);
-        mc0_axi_rresp.write(trans.resp);
-        mc0_axi_rlast.write(trans.last);
-        axi_r_valid_reg = true;
-        
-        std::cout << "@" << sc_time_stamp() << " AXI Read Data: ID=" 
-                  << std::hex << trans.id << " Data=0x" << trans.data 
-                  << " Last=" << trans.last << " Resp=" << (int)trans.resp << std::endl;
-    } else if (axi_r_valid_reg && mc0_axi_rready.read()) {
-        axi_r_valid_reg = false;
-    }
-    
-    mc0_axi_rvalid.write(axi_r_valid_reg);
-}
-
-// Enhanced APB Register Interface Process
-void openddrSystemCModelEnhanced::apb_process() {
-    if (!mc_rst_b.read()) {
-        mc_prdata.write(0);
-        mc_pready.write(false);
-        mc_pslverr.write(false);
-        apb_state = APB_IDLE;
-        return;
-    }
-
-    switch (apb_state) {
-        case APB_IDLE:
-            if (mc_psel.read()) {
-                apb_state = APB_SETUP;
-                mc_pready.write(false);
-            }
-            break;
-            
-        case APB_SETUP:
-            if (mc_penable.read()) {
-                apb_state = APB_ACCESS;
-                sc_uint<10> addr = mc_paddr.read();
-                
-                if (mc_pwr.read()) {
-                    // Write operation
-                    sc_uint<32> data = mc_pwdata.read();
-                    write_register(addr, data);
-                    std::cout << "@" << sc_time_stamp() << " APB Write: Addr=0x" 
-                              << std::hex << addr << " Data=0x" << data << std::endl;
-                } else {
-                    // Read operation
-                    sc_uint<32> data = read_register(addr);
-                    mc_prdata.write(data);
-                    std::cout << "@" << sc_time_stamp() << " APB Read: Addr=0x" 
-                              << std::hex << addr << " Data=0x" << data << std::endl;
-                }
-                
-                mc_pready.write(true);
-                mc_pslverr.write(false);
-            }
-            break;
-            
-        case APB_ACCESS:
-            if (!mc_psel.read()) {
-                apb_state = APB_IDLE;
-                mc_pready.write(false);
-            }
-            break;
-    }
-}
-
-// Enhanced Scheduler Process - COMPLETELY REMOVES ALL VERIFICATION
-void openddrSystemCModelEnhanced::scheduler_process() {
-    if (!mc_rst_b.read()) {
-        bufacc_cycle_en = false;
-        bufacc_cycle_mode_wr = false;
-        return;
-    }
-
-    // Enhanced scheduler logic with NO verification whatsoever
-    bool has_write_work = !write_addr_queue.empty() && !write_data_queue.empty();
-    bool has_read_work = !read_addr_queue.empty();
-    
-    if (has_write_work || has_read_work) {
-        bufacc_cycle_en = true;
-        
-        // Priority-based scheduling (writes have higher priority)
-        if (has_write_work) {
-            bufacc_cycle_mode_wr = true;
-            
-            // Process write transaction
-            AXITransaction addr_trans = write_addr_queue.front();
-            AXITransaction data_trans = write_data_queue.front();
-            write_addr_queue.pop();
-            write_data_queue.pop();
-            
-            // Store data in memory model
-            write_memory_block(addr_trans.addr, data_trans.data, data_trans.strb);
-            
-            // Create DDR command
-            DDRCommand ddr_cmd;
-            int rank, bank;
-            sc_uint<ROW_WIDTH> row;
-            sc_uint<COL_WIDTH> col;
-            decode_address(addr_trans.addr, rank, bank, row, col);
-            
-            ddr_cmd.original_addr = addr_trans.addr;
-            
-            // Check for page hit/miss
-            if (check_page_hit(bank, row)) {
-                page_hits++;
-                ddr_cmd.cmd_type = DDRCommand::CMD_WRITE;
-            } else {
-                page_misses++;
-                // Need activate first, then write
-                DDRCommand act_cmd;
-                act_cmd.cmd_type = DDRCommand::CMD_ACT;
-                act_cmd.rank = rank;
-                act_cmd.bank = bank;
-                act_cmd.row = row;
-                act_cmd.original_addr = addr_trans.addr;
-                schedule_ddr_command(act_cmd);
-                
-                ddr_cmd.cmd_type = DDRCommand::CMD_WRITE;
-                update_page_table(bank, row, true);
-            }
-            
-            ddr_cmd.rank = rank;
-            ddr_cmd.bank = bank;
-            ddr_cmd.row = row;
-            ddr_cmd.col = col;
-            
-            // Convert 64-bit AXI data to 16x32-bit DFI data
-            for (int i = 0; i < 16; i++) {
-                if (i < 2) {
-                    ddr_cmd.data[i] = (data_trans.data >> (i * 32)) & 0xFFFFFFFF;
-                } else {
-                    ddr_cmd.data[i] = 0;
-                }
-                ddr_cmd.mask[i] = (data_trans.strb >> (i * 4)) & 0xF;
-            }
-            
-            schedule_ddr_command(ddr_cmd);
-            
-            // Add to write response queue
-            AXITransaction resp_trans;
-            resp_trans.id = addr_trans.id;
-            resp_trans.resp = addr_trans.resp;
-            write_resp_queue.push(resp_trans);
-            
-        } else if (has_read_work) {
-            bufacc_cycle_mode_wr = false;
-            
-            // Process read transaction
-            AXITransaction addr_trans = read_addr_queue.front();
-            read_addr_queue.pop();
-            
-            // Create DDR command
-            DDRCommand ddr_cmd;
-            int rank, bank;
-            sc_uint<ROW_WIDTH> row;
-            sc_uint<COL_WIDTH> col;
-            decode_address(addr_trans.addr, rank, bank, row, col);
-            
-            ddr_cmd.original_addr = addr_trans.addr;
-            
-            // Check for page hit/miss
-            if (check_page_hit(bank, row)) {
-                page_hits++;
-                ddr_cmd.cmd_type = DDRCommand::CMD_READ;
-            } else {
-                page_misses++;
-                // Need activate first, then read
-                DDRCommand act_cmd;
-                act_cmd.cmd_type = DDRCommand::CMD_ACT;
-                act_cmd.rank = rank;
-                act_cmd.bank = bank;
-                act_cmd.row = row;
-                act_cmd.original_addr = addr_trans.addr;
-                schedule_ddr_command(act_cmd);
-                
-                ddr_cmd.cmd_type = DDRCommand::CMD_READ;
-                update_page_table(bank, row, true);
-            }
-            
-            ddr_cmd.rank = rank;
-            ddr_cmd.bank = bank;
-            ddr_cmd.row = row;
-            ddr_cmd.col = col;
-            ddr_cmd.buf_index = 0; // Simplified
-            
-            schedule_ddr_command(ddr_cmd);
-            
-            // Generate read data from memory model - NO VERIFICATION
-            sc_uint<64> read_data = read_memory_block(addr_trans.addr);
-            
-            // NO DATA VERIFICATION - Accept all read data as valid
-            // The memory model handles both stored and pattern data correctly
-            
-            AXITransaction resp_trans;
-            resp_trans.id = addr_trans.id;
-            resp_trans.data = read_data;
-            resp_trans.last = true; // Simplified - single beat
-            resp_trans.resp = addr_trans.resp;
-            read_resp_queue.push(resp_trans);
-        }
-    } else {
-        bufacc_cycle_en = false;
-    }
-}
-
-// Enhanced Sequencer Process
-void openddrSystemCModelEnhanced::sequencer_process() {
-    if (!mc_rst_b.read()) {
-        seq_state = SEQ_IDLE;
-        total_ddr_commands = 0;
-        return;
-    }
-
-    // Enhanced sequencer state machine with NO timing checks
-    switch (seq_state) {
-        case SEQ_IDLE:
-            if (!ddr_cmd_queue.empty()) {
-                DDRCommand cmd = ddr_cmd_queue.front();
-                ddr_cmd_queue.pop();
-                
-                // NO TIMING CHECKS - Execute all commands immediately
-                execute_ddr_command(cmd);
-                update_bank_timing(cmd.bank, cmd);
-                total_ddr_commands++;
-                
-                // Transition to appropriate wait state based on command type
-                switch (cmd.cmd_type) {
-                    case DDRCommand::CMD_ACT:
-                        seq_state = SEQ_W_ACT;
-                        break;
-                    case DDRCommand::CMD_WRITE:
-                        seq_state = SEQ_W_WR;
-                        break;
-                    case DDRCommand::CMD_READ:
-                        seq_state = SEQ_W_RD;
-                        break;
-                    case DDRCommand::CMD_PRE:
-                    case DDRCommand::CMD_PREA:
-                        seq_state = SEQ_W_PRE;
-                        break;
-                    case DDRCommand::CMD_REF:
-                        seq_state = SEQ_W_REF;
-                        break;
-                    default:
-                        seq_state = SEQ_IDLE;
-                        break;
-                }
-            }
-            break;
-            
-        case SEQ_W_ACT:
-            // Wait for tRCD (simplified - few cycles)
-            static int act_wait_cycles = 0;
-            act_wait_cycles++;
-            if (act_wait_cycles >= 3) {
-                act_wait_cycles = 0;
-                seq_state = SEQ_IDLE;
-            }
-            break;
-            
-        case SEQ_W_WR:
-            // Wait for write completion
-            static int wr_wait_cycles = 0;
-            wr_wait_cycles++;
-            if (wr_wait_cycles >= 2) {
-                wr_wait_cycles = 0;
-                seq_state = SEQ_IDLE;
-            }
-            break;
-            
-        case SEQ_W_RD:
-            // Wait for read completion
-            static int rd_wait_cycles = 0;
-            rd_wait_cycles++;
-            if (rd_wait_cycles >= 4) {
-                rd_wait_cycles = 0;
-                seq_state = SEQ_IDLE;
-            }
-            break;
-            
-        case SEQ_W_PRE:
-            // Wait for tRP
-            static int pre_wait_cycles = 0;
-            pre_wait_cycles++;
-            if (pre_wait_cycles >= 2) {
-                pre_wait_cycles = 0;
-                seq_state = SEQ_IDLE;
-            }
-            break;
-            
-        case SEQ_W_REF:
-            // Wait for tRFC
-            static int ref_wait_cycles = 0;
-            ref_wait_cycles++;
-            if (ref_wait_cycles >= 10) {
-                ref_wait_cycles = 0;
-                seq_state = SEQ_IDLE;
-                // Decrement refresh pending counter when refresh completes
-                if (refresh_pending_counter > 0) {
-                    refresh_pending_counter--;
-                }
-            }
-            break;
-            
-        default:
-            seq_state = SEQ_IDLE;
-            break;
-    }
-}
-
-// Enhanced DFI Command Process
-void openddrSystemCModelEnhanced::dfi_command_process() {
-    if (!mc_rst_b.read()) {
-        dfi_cs_0_p0.write(0);
-        dfi_cs_0_p1.write(0);
-        dfi_cs_1_p2.write(0);
-        dfi_cs_1_p3.write(0);
-        dfi_address_0_p0.write(0);
-        dfi_address_0_p1.write(0);
-        dfi_address_1_p2.write(0);
-        dfi_address_1_p3.write(0);
-        dfi_reset_n.write(false);
-        dfi_dram_clk_disable_0.write(3);
-        dfi_dram_clk_disable_1.write(3);
-        dfi_dram_ca_disable.write(true);
-        dfi_wck_cs.write(0);
-        dfi_wck_en.write(0);
-        dfi_wck_toggle.write(0);
-        return;
-    }
-
-    // Enable clocks and CA after reset
-    dfi_reset_n.write(true);
-    dfi_dram_clk_disable_0.write(0);
-    dfi_dram_clk_disable_1.write(0);
-    dfi_dram_ca_disable.write(false);
-
-    // Enhanced DFI command generation based on sequencer state
-    if (seq_state != SEQ_IDLE && !ddr_cmd_queue.empty()) {
-        // Generate realistic DFI commands
-        dfi_cs_0_p0.write(1); // Chip select active
-        dfi_address_0_p0.write(0x55); // Example command encoding
-        
-        // WCK control for DDR
-        dfi_wck_cs.write(1);
-        dfi_wck_en.write(1);
-        dfi_wck_toggle.write(1);
-    } else {
-        // Default NOP command
-        dfi_cs_0_p0.write(0);
-        dfi_cs_0_p1.write(0);
-        dfi_cs_1_p2.write(0);
-        dfi_cs_1_p3.write(0);
-        dfi_address_0_p0.write(0);
-        dfi_address_0_p1.write(0);
-        dfi_address_1_p2.write(0);
-        dfi_address_1_p3.write(0);
-        dfi_wck_cs.write(0);
-        dfi_wck_en.write(0);
-        dfi_wck_toggle.write(0);
-    }
-}
-
-// Enhanced DFI Write Data Process
-void openddrSystemCModelEnhanced::dfi_write_data_process() {
-    if (!mc_rst_b.read()) {
-        // Reset all write data outputs
-        dfi_wrdata_0.write(0);
-        dfi_wrdata_1.write(0);
-        dfi_wrdata_2.write(0);
-        dfi_wrdata_3.write(0);
-        dfi_wrdata_4.write(0);
-        dfi_wrdata_5.write(0);
-        dfi_wrdata_6.write(0);
-        dfi_wrdata_7.write(0);
-        dfi_wrdata_8.write(0);
-        dfi_wrdata_9.write(0);
-        dfi_wrdata_10.write(0);
-        dfi_wrdata_11.write(0);
-        dfi_wrdata_12.write(0);
-        dfi_wrdata_13.write(0);
-        dfi_wrdata_14.write(0);
-        dfi_wrdata_15.write(0);
-        
-        // Reset write data masks and enables
-        for (int i = 0; i < 16; i++) {
-            // Would set each dfi_wrdata_mask_X and dfi_wrdata_en_X to 0
-        }
-        dfi_wrdata_mask_0.write(0);
-        dfi_wrdata_mask_1.write(0);
-        dfi_wrdata_mask_2.write(0);
-        dfi_wrdata_mask_3.write(0);
-        dfi_wrdata_en_0.write(0);
-        dfi_wrdata_en_1.write(0);
-        dfi_wrdata_en_2.write(0);
-        dfi_wrdata_en_3.write(0);
-        return;
-    }
-
-    // Enhanced write data handling for DDR
-    if (seq_state == SEQ_W_WR && bufacc_cycle_mode_wr) {
-        // Generate write data patterns across multiple phases
-        dfi_wrdata_0.write(0x12345678);
-        dfi_wrdata_1.write(0x9ABCDEF0);
-        dfi_wrdata_2.write(0x11223344);
-        dfi_wrdata_3.write(0x55667788);
-        
-        // Enable write data
-        dfi_wrdata_en_0.write(0xF);
-        dfi_wrdata_en_1.write(0xF);
-        dfi_wrdata_en_2.write(0xF);
-        dfi_wrdata_en_3.write(0xF);
-        
-        // Set write masks (all enabled)
-        dfi_wrdata_mask_0.write(0x0);
-        dfi_wrdata_mask_1.write(0x0);
-        dfi_wrdata_mask_2.write(0x0);
-        dfi_wrdata_mask_3.write(0x0);
-    } else {
-        // Clear outputs when not writing
-        dfi_wrdata_0.write(0);
-        dfi_wrdata_1.write(0);
-        dfi_wrdata_2.write(0);
-        dfi_wrdata_3.write(0);
-        dfi_wrdata_en_0.write(0);
-        dfi_wrdata_en_1.write(0);
-        dfi_wrdata_en_2.write(0);
-        dfi_wrdata_en_3.write(0);
-    }
-}
-
-// Enhanced DFI Read Data Process
-void openddrSystemCModelEnhanced::dfi_read_data_process() {
-    if (!mc_rst_b.read()) {
-        mc_rdrst_b.write(false);
-        mc_rcv_en.write(false);
-        dfi_rddata_en.write(false);
-        return;
-    }
-
-    // Enhanced read data handling
-    mc_rdrst_b.write(true);
-    mc_rcv_en.write(true);
-    
-    // Enable read data capture during read operations
-    if (seq_state == SEQ_W_RD) {
-        dfi_rddata_en.write(true);
-    } else {
-        dfi_rddata_en.write(false);
-    }
-}
-
-// Enhanced Refresh Timer Process
-void openddrSystemCModelEnhanced::refresh_timer_process() {
-    if (!porst_b.read()) {
-        refresh_counter = 0;
-        refresh_pending_counter = 0;
-        return;
-    }
-
-    // Enhanced refresh timer with realistic DDR timing
-    refresh_counter++;
-    if (refresh_counter >= 1950) { // 7.8us at 250MHz clock
-        refresh_counter = 0;
-        if (refresh_pending_counter < 8) { // Max 8 pending refreshes
-            refresh_pending_counter++;
-            
-            // Only schedule refresh if not too many are pending
-            if (refresh_pending_counter <= 6) { // Keep some headroom
-                DDRCommand ref_cmd;
-                ref_cmd.cmd_type = DDRCommand::CMD_REF;
-                ref_cmd.rank = 0; // Refresh all ranks
-                schedule_ddr_command(ref_cmd);
-                
-                std::cout << "@" << sc_time_stamp() << " Refresh scheduled, pending=" 
-                          << (int)refresh_pending_counter << std::endl;
-            }
-        } else {
-            std::cout << "@" << sc_time_stamp() << " Refresh skipped - too many pending (" 
-                      << (int)refresh_pending_counter << ")" << std::endl;
-        }
-    }
-}
-
-// COMPLETELY DISABLED Verification Process - NO VERIFICATION AT ALL
-void openddrSystemCModelEnhanced::verification_process() {
-    if (!mc_rst_b.read()) {
-        queue_overflow_active = false;
-        return;
-    }
-
-    // NO VERIFICATION - This process does nothing except track queue sizes for info
-    // No errors will be reported - all transactions are considered valid
-    
-    // Check for queue overflows with smart logging only (no errors)
-    bool current_overflow = (write_addr_queue.size() > 63 || read_addr_queue.size() > 63);
-    
-    if (current_overflow && !queue_overflow_active) {
-        // Log when overflow starts (info only)
-        queue_overflow_active = true;
-        std::cout << "@" << sc_time_stamp() << " INFO: High queue usage - "
-                  << "WR_Q=" << write_addr_queue.size() 
-                  << " RD_Q=" << read_addr_queue.size() 
-                  << " (threshold=63)" << std::endl;
-    } else if (!current_overflow && queue_overflow_active) {
-        // Log when overflow ends (info only)
-        queue_overflow_active = false;
-        std::cout << "@" << sc_time_stamp() << " INFO: Queue usage normalized - "
-                  << "WR_Q=" << write_addr_queue.size() 
-                  << " RD_Q=" << read_addr_queue.size() << std::endl;
-    }
-    
-    // NO REFRESH TIMEOUT CHECKS - All refresh operations are accepted
-    
-    // Periodic statistics reporting (info only - no errors)
-    static int stats_counter = 0;
-    stats_counter++;
-    if (stats_counter >= 10000) { // Every 10k cycles
-        stats_counter = 0;
-        if (total_write_transactions > 0 || total_read_transactions > 0) {
-            std::cout << "@" << sc_time_stamp() << " Periodic Stats: "
-                      << "WR=" << total_write_transactions 
-                      << " RD=" << total_read_transactions
-                      << " WR_Q=" << write_addr_queue.size()
-                      << " RD_Q=" << read_addr_queue.size()
-                      << " Info_Only" << std::endl;
-        }
-    }
-}
-
-// Helper Functions Implementation
-
-void openddrSystemCModelEnhanced::reset_model() {
-    seq_state = SEQ_IDLE;
-    apb_state = APB_IDLE;
-    ddr_init_done = false;
-    bufacc_cycle_en = false;
-    bufacc_cycle_mode_wr = false;
-    refresh_counter = 0;
-    refresh_pending_counter = 0;
-    
-    // Reset AXI state
-    axi_aw_ready_reg = false;
-    axi_w_ready_reg = false;
-    axi_b_valid_reg = false;
-    axi_ar_ready_reg = false;
-    axi_r_valid_reg = false;
-    
-    // Clear all queues
-    while (!write_addr_queue.empty()) write_addr_queue.pop();
-    while (!write_data_queue.empty()) write_data_queue.pop();
-    while (!write_resp_queue.empty()) write_resp_queue.pop();
-    while (!read_addr_queue.empty()) read_addr_queue.pop();
-    while (!read_resp_queue.empty()) read_resp_queue.pop();
-    while (!ddr_cmd_queue.empty()) ddr_cmd_queue.pop();
-    
-    // Reset statistics
-    total_write_transactions = 0;
-    total_read_transactions = 0;
-    total_ddr_commands = 0;
-    page_hits = 0;
-    page_misses = 0;
-    data_errors = 0;
-    address_errors = 0;
-    timing_violations = 0;
-}
-
-void openddrSystemCModelEnhanced::update_page_table(int bank, sc_uint<ROW_WIDTH> row, bool open) {
-    if (bank < PAGE_TABLE_DEPTH) {
-        page_table_vld_memory[bank] = open;
-        if (open) {
-            page_table_row_memory[bank] = row;
-        }
-    }
-}
-
-bool openddrSystemCModelEnhanced::check_page_hit(int bank, sc_uint<ROW_WIDTH> row) {
-    if (bank < PAGE_TABLE_DEPTH && page_table_vld_memory[bank]) {
-        return (page_table_row_memory[bank] == row);
-    }
-    return false;
-}
-
-void openddrSystemCModelEnhanced::schedule_ddr_command(const DDRCommand& cmd) {
-    ddr_cmd_queue.push(cmd);
-}
-
-void openddrSystemCModelEnhanced::execute_ddr_command(const DDRCommand& cmd) {
-    std::cout << "@" << sc_time_stamp() << " DDR Command: ";
-    switch (cmd.cmd_type) {
-        case DDRCommand::CMD_ACT:
-            std::cout << "ACTIVATE Bank=" << cmd.bank << " Row=0x" << std::hex << cmd.row;
-            break;
-        case DDRCommand::CMD_READ:
-            std::cout << "READ Bank=" << cmd.bank << " Col=0x" << std::hex << cmd.col;
-            break;
-        case DDRCommand::CMD_WRITE:
-            std::cout << "WRITE Bank=" << cmd.bank << " Col=0x" << std::hex << cmd.col;
-            break;
-        case DDRCommand::CMD_PRE:
-            std::cout << "PRECHARGE Bank=" << cmd.bank;
-            break;
-        case DDRCommand::CMD_REF:
-            std::cout << "REFRESH";
-            break;
-        default:
-            std::cout << "NOP";
-            break;
-    }
-    std::cout << std::endl;
-}
-
-sc_uint<32> openddrSystemCModelEnhanced::read_register(sc_uint<10> addr) {
-    switch (addr.to_uint()) {
-        case 0x000: return seq_control_reg;
-        case 0x004: return buf_config_reg;
-        case 0x008: return ddr_config_reg;
-        case 0x00C: return ddr_adr_config_reg;
-        case 0x010: return pmu_cmd_reg;
-        case 0x014: return pmu_mrs_reg;
-        case 0x018: return pmu_mpc_reg;
-        case 0x01C: return pmu_status_reg;
-        case 0x020: return ac_timing_reg1;
-        case 0x024: return ac_timing_reg2;
-        case 0x028: return ac_timing_reg3;
-        case 0x02C: return ac_timing_reg4;
-        case 0x030: return ac_timing_reg5;
-        case 0x034: return ac_timing_reg6;
-        case 0x038: return ac_timing_reg7;
-        case 0x03C: return ac_timing_reg8;
-        case 0x040: return ac_timing_reg9;
-        case 0x044: return ac_timing_reg10;
-        case 0x048: return refresh_cntrl_reg;
-        case 0x04C: return test_config_reg;
-        case 0x100: return total_write_transactions;
-        case 0x104: return total_read_transactions;
-        case 0x108: return total_ddr_commands;
-        case 0x10C: return page_hits;
-        case 0x110: return page_misses;
-        case 0x114: return data_errors;
-        case 0x118: return address_errors;
-        case 0x11C: return timing_violations;
-        default: return 0xDEADBEEF;
-    }
-}
-
-void openddrSystemCModelEnhanced::write_register(sc_uint<10> addr, sc_uint<32> data) {
-    switch (addr.to_uint()) {
-        case 0x000: seq_control_reg = data; break;
-        case 0x004: buf_config_reg = data; break;
-        case 0x008: ddr_config_reg = data; break;
-        case 0x00C: ddr_adr_config_reg = data; break;
-        case 0x010: pmu_cmd_reg = data; break;
-        case 0x014: pmu_mrs_reg = data; break;
-        case 0x018: pmu_mpc_reg = data; break;
-        case 0x01C: pmu_status_reg = data; break;
-        case 0x020: ac_timing_reg1 = data; break;
-        case 0x024: ac_timing_reg2 = data; break;
-        case 0x028: ac_timing_reg3 = data; break;
-        case 0x02C: ac_timing_reg4 = data; break;
-        case 0x030: ac_timing_reg5 = data; break;
-        case 0x034: ac_timing_reg6 = data; break;
-        case 0x038: ac_timing_reg7 = data; break;
-        case 0x03C: ac_timing_reg8 = data; break;
-        case 0x040: ac_timing_reg9 = data; break;
-        case 0x044: ac_timing_reg10 = data; break;
-        case 0x048: refresh_cntrl_reg = data; break;
-        case 0x04C: test_config_reg = data; break;
-        default: break;
-    }
-}
-
-void openddrSystemCModelEnhanced::decode_address(sc_uint<40> addr, int& rank, int& bank, 
-                                               sc_uint<ROW_WIDTH>& row, sc_uint<COL_WIDTH>& col) {
-    // Enhanced address decoding for DDR
-    // This is a simplified mapping - real implementation would be configurable
-    rank = (addr >> 30) & 0x1;  // 1 bit for rank
-    bank = (addr >> 6) & 0xF;   // 4 bits for bank (16 banks)
-    row = (addr >> 10) & 0xFFFF; // 16 bits for row
-    col = (addr >> 3) & 0x3FF;   // 10 bits for column
-}
-
-void openddrSystemCModelEnhanced::print_statistics() {
-    std::cout << "\n=== Enhanced openddr SystemC Model Statistics ===" << std::endl;
-    std::cout << "Total Write Transactions: " << std::setfill('0') << std::setw(9) 
-              << total_write_transactions << std::endl;
-    std::cout << "Total Read Transactions:  " << std::setfill('0') << std::setw(9) 
-              << total_read_transactions << std::endl;
-    std::cout << "Total DDR Commands:       " << std::setfill('0') << std::setw(9) 
-              << total_ddr_commands << std::endl;
-    std::cout << "Page Hits:                " << std::setfill('0') << std::setw(9) 
-              << page_hits << std::endl;
-    std::cout << "Page Misses:              " << std::setfill('0') << std::setw(9) 
-              << page_misses << std::endl;
-    std::cout << "Data Errors:              " << std::setfill('0') << std::setw(9) 
-              << data_errors << std::endl;
-    std::cout << "Address Errors:           " << std::setfill('0') << std::setw(9) 
-              << address_errors << std::endl;
-    std::cout << "Timing Violations:        " << std::setfill('0') << std::setw(9) 
-              << timing_violations << std::endl;
-    
-    if (page_hits + page_misses > 0) {
-        double hit_rate = (double)page_hits / (page_hits + page_misses) * 100.0;
-        std::cout << "Page Hit Rate:            " << std::fixed << std::setprecision(2) 
-                  << hit_rate << "%" << std::endl;
-    }
-    std::cout << "=================================================" << std::endl;
-}
-
-// Enhanced verification functions - ALL DISABLED
-sc_uint<64> openddrSystemCModelEnhanced::generate_data_pattern(sc_uint<40> addr, DataPattern pattern) {
-    sc_uint<64> data = 0;
-    
-    switch (pattern) {
-        case PATTERN_INCREMENTAL:
-            data = addr & 0xFFFFFFFFFFFFFFFFULL;
-            break;
-        case PATTERN_WALKING_ONES:
-            data = 1ULL << (addr & 0x3F);
-            break;
-        case PATTERN_WALKING_ZEROS:
-            data = ~(1ULL << (addr & 0x3F));
-            break;
-        case PATTERN_CHECKERBOARD:
-            data = (addr & 1) ? 0xAAAAAAAAAAAAAAAAULL : 0x5555555555555555ULL;
-            break;
-        case PATTERN_RANDOM:
-            data = random_generator();
-            data = (data << 32) | random_generator();
-            break;
-        case PATTERN_ADDRESS_BASED:
-            data = addr;
-            data = (data << 32) | (~addr & 0xFFFFFFFF);
-            break;
-        case PATTERN_CUSTOM:
-            data = 0x123456789ABCDEF0ULL;
-            break;
-        default:
-            data = 0;
-            break;
-    }
-    
-    return data;
-}
-
-bool openddrSystemCModelEnhanced::verify_data_pattern(sc_uint<40> addr, sc_uint<64> data, DataPattern pattern) {
-    // ALWAYS RETURN TRUE - NO VERIFICATION
-    (void)addr; // Suppress unused parameter warnings
-    (void)data;
-    (void)pattern;
-    return true;
-}
-
-void openddrSystemCModelEnhanced::write_memory_block(sc_uint<40> addr, sc_uint<64> data, sc_uint<8> strb) {
-    uint64_t block_addr = addr.to_uint64() & ~(BLOCK_SIZE - 1);
-    uint32_t offset = addr.to_uint64() & (BLOCK_SIZE - 1);
-    
-    // Create block if it doesn't exist
-    if (memory_blocks.find(block_addr) == memory_blocks.end()) {
-        memory_blocks[block_addr] = MemoryBlock();
-    }
-    
-    MemoryBlock& block = memory_blocks[block_addr];
-    
-    // Write data with byte strobes - handle full 64-bit data
-    if (strb == 0xFF) {
-        // Full 8-byte write - most common case
-        for (int i = 0; i < 8; i++) {
-            if (offset + i < BLOCK_SIZE) {
-                block.data[offset + i] = (data >> (i * 8)) & 0xFF;
-            }
-        }
-    } else {
-        // Partial write with strobes
-        for (int i = 0; i < 8; i++) {
-            if (strb & (1 << i)) {
-                if (offset + i < BLOCK_SIZE) {
-                    block.data[offset + i] = (data >> (i * 8)) & 0xFF;
-                }
-            }
-        }
-    }
-    
-    block.initialized = true;
-    block.last_access = sc_time_stamp();
-    block.access_count++;
-    
-    // Debug log for writes
-    std::cout << "@" << sc_time_stamp() << " Memory Write: Addr=0x" << std::hex << addr
-              << " Data=0x" << data << " Strb=0x" << (int)strb 
-              << " Block=0x" << block_addr << " Offset=" << std::dec << offset << std::endl;
-}
-
-sc_uint<64> openddrSystemCModelEnhanced::read_memory_block(sc_uint<40> addr) {
-    uint64_t block_addr = addr.to_uint64() & ~(BLOCK_SIZE - 1);
-    uint32_t offset = addr.to_uint64() & (BLOCK_SIZE - 1);
-    
-    sc_uint<64> data = 0;
-    
-    if (memory_blocks.find(block_addr) != memory_blocks.end()) {
-        MemoryBlock& block = memory_blocks[block_addr];
-        
-        // Read 8 bytes
-        for (int i = 0; i < 8; i++) {
-            if (offset + i < BLOCK_SIZE) {
-                data |= ((sc_uint<64>)block.data[offset + i]) << (i * 8);
-            }
-        }
-        
-        block.last_access = sc_time_stamp();
-        block.access_count++;
-        
-        // Debug log for reads
-        std::cout << "@" << sc_time_stamp() << " Memory Read: Addr=0x" << std::hex << addr
-                  << " Data=0x" << data << " Block=0x" << block_addr 
-                  << " Offset=" << std::dec << offset << " Initialized=" << block.initialized << std::endl;
-    } else {
-        // Return pattern for uninitialized memory
-        data = generate_data_pattern(addr, current_pattern);
-        std::cout << "@" << sc_time_stamp() << " Memory Read (uninitialized): Addr=0x" << std::hex << addr
-                  << " Pattern=0x" << data << std::endl;
-    }
-    
-    return data;
-}
-
-bool openddrSystemCModelEnhanced::check_timing_constraints(const DDRCommand& cmd) {
-    // ALWAYS RETURN TRUE - NO TIMING CHECKS
-    (void)cmd; // Suppress unused parameter warning
-    return true;
-}
-
-void openddrSystemCModelEnhanced::update_bank_timing(int bank, const DDRCommand& cmd) {
-    sc_time current_time = sc_time_stamp();
-    
-    switch (cmd.cmd_type) {
-        case DDRCommand::CMD_ACT:
-            bank_last_activate[bank] = current_time;
-            break;
-        case DDRCommand::CMD_PRE:
-        case DDRCommand::CMD_PREA:
-            bank_last_precharge[bank] = current_time;
-            break;
-        default:
-            break;
-    }
-}
-
-void openddrSystemCModelEnhanced::log_verification_error(const std::string& error_type, 
-                                                       sc_uint<40> addr, const std::string& details) {
-    // DISABLED - NO ERROR LOGGING
-    (void)error_type; // Suppress unused parameter warnings
-    (void)addr;
-    (void)details;
-    // Do nothing - all verification is disabled
-}
-
-// Test pattern generators (simplified implementations) - ALL DISABLED
-void openddrSystemCModelEnhanced::run_address_test() {
-    std::cout << "Address test disabled - no verification" << std::endl;
-}
-
-void openddrSystemCModelEnhanced::run_data_pattern_test() {
-    std::cout << "Data pattern test disabled - no verification" << std::endl;
-}
-
-void openddrSystemCModelEnhanced::run_burst_test() {
-    std::cout << "Burst test disabled - no verification" << std::endl;
-}
-
-void openddrSystemCModelEnhanced::run_bank_interleaving_test() {
-    std::cout << "Bank interleaving test disabled - no verification" << std::endl;
-}
-
-void openddrSystemCModelEnhanced::run_refresh_test() {
-    std::cout << "Refresh test disabled - no verification" << std::endl;
-}
-
-void openddrSystemCModelEnhanced::run_timing_test() {
-    std::cout << "Timing test disabled - no verification" << std::endl;
-}
+template class OpenDDRController<VerificationDisabledModelPolicy>;
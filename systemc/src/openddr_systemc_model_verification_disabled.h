@@ -0,0 +1,25 @@
+#ifndef OPENDDR_SYSTEMC_MODEL_VERIFICATION_DISABLED_H
+#define OPENDDR_SYSTEMC_MODEL_VERIFICATION_DISABLED_H
+
+#include "openddr_controller.h"
+
+// Enhanced model with bank timing tracking and the verification monitor
+// compiled out; used by the QEMU bridge, where throughput matters more than
+// checking
+struct VerificationDisabledModelPolicy {
+    typedef WriteFirstScheduler Scheduler;
+    typedef SimplifiedTiming<false> Timing;
+    typedef VerificationOff Verification;
+    typedef LogUpTo<> Logging;
+    typedef SparseBlockStore Store;
+    typedef InterleavedAddressMap AddressMap;
+
+    static ModelConfig default_config() { return ModelConfig(); }
+    static const char* name() { return "OpenDDR SystemC Model (verification disabled)"; }
+};
+
+typedef OpenDDRController<VerificationDisabledModelPolicy> OpenDDRSystemCModelVerificationDisabled;
+
+extern template class OpenDDRController<VerificationDisabledModelPolicy>;
+
+#endif // OPENDDR_SYSTEMC_MODEL_VERIFICATION_DISABLED_H
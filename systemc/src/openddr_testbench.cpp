@@ -1,5 +1,7 @@
 #define SC_INCLUDE_DYNAMIC_PROCESSES
 #include "openddr_systemc_model.h"
+#include "openddr_log.h"
+#include "openddr_seed.h"
 #include <systemc.h>
 
 // Simple AXI Master for testing
@@ -208,33 +210,29 @@ SC_MODULE(DDRPHY) {
     sc_in<sc_uint<2>> dfi_wck_toggle;
 
     // DFI Write Data Interface
-    sc_in<sc_uint<32>> dfi_wrdata_0;
-    sc_in<sc_uint<32>> dfi_wrdata_1;
-    sc_in<sc_uint<32>> dfi_wrdata_2;
-    sc_in<sc_uint<32>> dfi_wrdata_3;
-    sc_in<sc_uint<4>> dfi_wrdata_mask_0;
-    sc_in<sc_uint<4>> dfi_wrdata_mask_1;
-    sc_in<sc_uint<4>> dfi_wrdata_mask_2;
-    sc_in<sc_uint<4>> dfi_wrdata_mask_3;
-    sc_in<sc_uint<4>> dfi_wrdata_en_0;
-    sc_in<sc_uint<4>> dfi_wrdata_en_1;
-    sc_in<sc_uint<4>> dfi_wrdata_en_2;
-    sc_in<sc_uint<4>> dfi_wrdata_en_3;
+    DFIDataIn<32> dfi_wrdata;
+    DFIDataIn<4> dfi_wrdata_mask;
+    DFIDataIn<4> dfi_wrdata_en;
 
     // DFI Read Data Interface
     sc_in<bool> mc_rdrst_b;
     sc_in<bool> mc_rcv_en;
     sc_in<bool> dfi_rddata_en;
     sc_out<bool> dfi_rddata_valid;
-    sc_out<sc_uint<32>> dfi_rddata_0;
-    sc_out<sc_uint<32>> dfi_rddata_1;
-    sc_out<sc_uint<32>> dfi_rddata_2;
-    sc_out<sc_uint<32>> dfi_rddata_3;
+    DFIDataOut<32> dfi_rddata;
 
     // Memory array (simplified)
     std::map<sc_uint<40>, sc_uint<64>> memory;
 
-    SC_CTOR(DDRPHY) {
+    // Last read data driven, so unchanged phases are not rewritten
+    uint32_t rddata_shadow[DFI_DATA_PHASES] = {};
+
+    SC_CTOR(DDRPHY) :
+        dfi_wrdata("dfi_wrdata"),
+        dfi_wrdata_mask("dfi_wrdata_mask"),
+        dfi_wrdata_en("dfi_wrdata_en"),
+        dfi_rddata("dfi_rddata")
+    {
         SC_METHOD(dfi_monitor_process);
         sensitive << clk.pos();
         dont_initialize();
@@ -264,32 +262,28 @@ void DDRPHY::dfi_monitor_process() {
     }
     
     // Monitor write data
-    if (dfi_wrdata_en_0.read() != 0 || dfi_wrdata_en_1.read() != 0 ||
-        dfi_wrdata_en_2.read() != 0 || dfi_wrdata_en_3.read() != 0) {
+    if (dfi_wrdata_en.lane(0) != 0 || dfi_wrdata_en.lane(1) != 0 ||
+        dfi_wrdata_en.lane(2) != 0 || dfi_wrdata_en.lane(3) != 0) {
         
         std::cout << "@" << sc_time_stamp() << " PHY: Write Data - P0=0x" 
-                  << std::hex << dfi_wrdata_0.read() << " P1=0x" << dfi_wrdata_1.read()
-                  << " P2=0x" << dfi_wrdata_2.read() << " P3=0x" << dfi_wrdata_3.read() << std::endl;
+                  << std::hex << dfi_wrdata.lane(0) << " P1=0x" << dfi_wrdata.lane(1)
+                  << " P2=0x" << dfi_wrdata.lane(2) << " P3=0x" << dfi_wrdata.lane(3) << std::endl;
     }
 }
 
 void DDRPHY::read_data_process() {
     if (!rst_n.read()) {
+        const uint32_t rddata_idle[DFI_DATA_PHASES] = {};
         dfi_rddata_valid.write(false);
-        dfi_rddata_0.write(0);
-        dfi_rddata_1.write(0);
-        dfi_rddata_2.write(0);
-        dfi_rddata_3.write(0);
+        dfi_rddata.write_lanes(rddata_idle, rddata_shadow);
         return;
     }
 
     // Simple read data generation
     if (dfi_rddata_en.read()) {
         // Generate some test data
-        dfi_rddata_0.write(0x12345678);
-        dfi_rddata_1.write(0x9ABCDEF0);
-        dfi_rddata_2.write(0x11223344);
-        dfi_rddata_3.write(0x55667788);
+        const uint32_t rddata[DFI_DATA_PHASES] = { 0x12345678, 0x9ABCDEF0, 0x11223344, 0x55667788 };
+        dfi_rddata.write_lanes(rddata, rddata_shadow);
         dfi_rddata_valid.write(true);
         
         std::cout << "@" << sc_time_stamp() << " PHY: Read Data Generated" << std::endl;
@@ -430,6 +424,11 @@ void ResetGenerator::reset_sequence() {
 
 // Top-level testbench
 int sc_main(int argc, char* argv[]) {
+    // Logging is configured through OPENDDR_LOG_LEVEL/_CATEGORIES/_FILE
+    OpenDDRLog::configure_from_env();
+    // Random streams derive from OPENDDR_SEED (see openddr_seed.h)
+    OpenDDRSeed::configure_from_env();
+    
     // Clock and reset signals
     sc_clock mck("mck", 5, SC_NS); // 200MHz
     sc_clock axi_clk("axi_clk", 10, SC_NS); // 100MHz
@@ -469,25 +468,13 @@ int sc_main(int argc, char* argv[]) {
     sc_signal<sc_uint<2>> dfi_wck_toggle;
     
     // DFI Write Data (all 16 phases)
-    sc_signal<sc_uint<32>> dfi_wrdata_0, dfi_wrdata_1, dfi_wrdata_2, dfi_wrdata_3;
-    sc_signal<sc_uint<32>> dfi_wrdata_4, dfi_wrdata_5, dfi_wrdata_6, dfi_wrdata_7;
-    sc_signal<sc_uint<32>> dfi_wrdata_8, dfi_wrdata_9, dfi_wrdata_10, dfi_wrdata_11;
-    sc_signal<sc_uint<32>> dfi_wrdata_12, dfi_wrdata_13, dfi_wrdata_14, dfi_wrdata_15;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_0, dfi_wrdata_mask_1, dfi_wrdata_mask_2, dfi_wrdata_mask_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_4, dfi_wrdata_mask_5, dfi_wrdata_mask_6, dfi_wrdata_mask_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_8, dfi_wrdata_mask_9, dfi_wrdata_mask_10, dfi_wrdata_mask_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_12, dfi_wrdata_mask_13, dfi_wrdata_mask_14, dfi_wrdata_mask_15;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_0, dfi_wrdata_en_1, dfi_wrdata_en_2, dfi_wrdata_en_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_4, dfi_wrdata_en_5, dfi_wrdata_en_6, dfi_wrdata_en_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_8, dfi_wrdata_en_9, dfi_wrdata_en_10, dfi_wrdata_en_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_12, dfi_wrdata_en_13, dfi_wrdata_en_14, dfi_wrdata_en_15;
+    DFIDataSignal<32> dfi_wrdata("dfi_wrdata");
+    DFIDataSignal<4> dfi_wrdata_mask("dfi_wrdata_mask");
+    DFIDataSignal<4> dfi_wrdata_en("dfi_wrdata_en");
     
     // DFI Read Data
     sc_signal<bool> mc_rdrst_b, mc_rcv_en, dfi_rddata_en, dfi_rddata_valid;
-    sc_signal<sc_uint<32>> dfi_rddata_0, dfi_rddata_1, dfi_rddata_2, dfi_rddata_3;
-    sc_signal<sc_uint<32>> dfi_rddata_4, dfi_rddata_5, dfi_rddata_6, dfi_rddata_7;
-    sc_signal<sc_uint<32>> dfi_rddata_8, dfi_rddata_9, dfi_rddata_10, dfi_rddata_11;
-    sc_signal<sc_uint<32>> dfi_rddata_12, dfi_rddata_13, dfi_rddata_14, dfi_rddata_15;
+    DFIDataSignal<32> dfi_rddata("dfi_rddata");
 
     // Instantiate modules
     OpenDDRSystemCModel OpenDDR("OpenDDR");
@@ -575,75 +562,15 @@ int sc_main(int argc, char* argv[]) {
     OpenDDR.dfi_wck_en(dfi_wck_en);
     OpenDDR.dfi_wck_toggle(dfi_wck_toggle);
     
-    OpenDDR.dfi_wrdata_0(dfi_wrdata_0);
-    OpenDDR.dfi_wrdata_1(dfi_wrdata_1);
-    OpenDDR.dfi_wrdata_2(dfi_wrdata_2);
-    OpenDDR.dfi_wrdata_3(dfi_wrdata_3);
-    OpenDDR.dfi_wrdata_4(dfi_wrdata_4);
-    OpenDDR.dfi_wrdata_5(dfi_wrdata_5);
-    OpenDDR.dfi_wrdata_6(dfi_wrdata_6);
-    OpenDDR.dfi_wrdata_7(dfi_wrdata_7);
-    OpenDDR.dfi_wrdata_8(dfi_wrdata_8);
-    OpenDDR.dfi_wrdata_9(dfi_wrdata_9);
-    OpenDDR.dfi_wrdata_10(dfi_wrdata_10);
-    OpenDDR.dfi_wrdata_11(dfi_wrdata_11);
-    OpenDDR.dfi_wrdata_12(dfi_wrdata_12);
-    OpenDDR.dfi_wrdata_13(dfi_wrdata_13);
-    OpenDDR.dfi_wrdata_14(dfi_wrdata_14);
-    OpenDDR.dfi_wrdata_15(dfi_wrdata_15);
-    OpenDDR.dfi_wrdata_mask_0(dfi_wrdata_mask_0);
-    OpenDDR.dfi_wrdata_mask_1(dfi_wrdata_mask_1);
-    OpenDDR.dfi_wrdata_mask_2(dfi_wrdata_mask_2);
-    OpenDDR.dfi_wrdata_mask_3(dfi_wrdata_mask_3);
-    OpenDDR.dfi_wrdata_mask_4(dfi_wrdata_mask_4);
-    OpenDDR.dfi_wrdata_mask_5(dfi_wrdata_mask_5);
-    OpenDDR.dfi_wrdata_mask_6(dfi_wrdata_mask_6);
-    OpenDDR.dfi_wrdata_mask_7(dfi_wrdata_mask_7);
-    OpenDDR.dfi_wrdata_mask_8(dfi_wrdata_mask_8);
-    OpenDDR.dfi_wrdata_mask_9(dfi_wrdata_mask_9);
-    OpenDDR.dfi_wrdata_mask_10(dfi_wrdata_mask_10);
-    OpenDDR.dfi_wrdata_mask_11(dfi_wrdata_mask_11);
-    OpenDDR.dfi_wrdata_mask_12(dfi_wrdata_mask_12);
-    OpenDDR.dfi_wrdata_mask_13(dfi_wrdata_mask_13);
-    OpenDDR.dfi_wrdata_mask_14(dfi_wrdata_mask_14);
-    OpenDDR.dfi_wrdata_mask_15(dfi_wrdata_mask_15);
-    OpenDDR.dfi_wrdata_en_0(dfi_wrdata_en_0);
-    OpenDDR.dfi_wrdata_en_1(dfi_wrdata_en_1);
-    OpenDDR.dfi_wrdata_en_2(dfi_wrdata_en_2);
-    OpenDDR.dfi_wrdata_en_3(dfi_wrdata_en_3);
-    OpenDDR.dfi_wrdata_en_4(dfi_wrdata_en_4);
-    OpenDDR.dfi_wrdata_en_5(dfi_wrdata_en_5);
-    OpenDDR.dfi_wrdata_en_6(dfi_wrdata_en_6);
-    OpenDDR.dfi_wrdata_en_7(dfi_wrdata_en_7);
-    OpenDDR.dfi_wrdata_en_8(dfi_wrdata_en_8);
-    OpenDDR.dfi_wrdata_en_9(dfi_wrdata_en_9);
-    OpenDDR.dfi_wrdata_en_10(dfi_wrdata_en_10);
-    OpenDDR.dfi_wrdata_en_11(dfi_wrdata_en_11);
-    OpenDDR.dfi_wrdata_en_12(dfi_wrdata_en_12);
-    OpenDDR.dfi_wrdata_en_13(dfi_wrdata_en_13);
-    OpenDDR.dfi_wrdata_en_14(dfi_wrdata_en_14);
-    OpenDDR.dfi_wrdata_en_15(dfi_wrdata_en_15);
+    OpenDDR.dfi_wrdata(dfi_wrdata);
+    OpenDDR.dfi_wrdata_mask(dfi_wrdata_mask);
+    OpenDDR.dfi_wrdata_en(dfi_wrdata_en);
     
     OpenDDR.mc_rdrst_b(mc_rdrst_b);
     OpenDDR.mc_rcv_en(mc_rcv_en);
     OpenDDR.dfi_rddata_en(dfi_rddata_en);
     OpenDDR.dfi_rddata_valid(dfi_rddata_valid);
-    OpenDDR.dfi_rddata_0(dfi_rddata_0);
-    OpenDDR.dfi_rddata_1(dfi_rddata_1);
-    OpenDDR.dfi_rddata_2(dfi_rddata_2);
-    OpenDDR.dfi_rddata_3(dfi_rddata_3);
-    OpenDDR.dfi_rddata_4(dfi_rddata_4);
-    OpenDDR.dfi_rddata_5(dfi_rddata_5);
-    OpenDDR.dfi_rddata_6(dfi_rddata_6);
-    OpenDDR.dfi_rddata_7(dfi_rddata_7);
-    OpenDDR.dfi_rddata_8(dfi_rddata_8);
-    OpenDDR.dfi_rddata_9(dfi_rddata_9);
-    OpenDDR.dfi_rddata_10(dfi_rddata_10);
-    OpenDDR.dfi_rddata_11(dfi_rddata_11);
-    OpenDDR.dfi_rddata_12(dfi_rddata_12);
-    OpenDDR.dfi_rddata_13(dfi_rddata_13);
-    OpenDDR.dfi_rddata_14(dfi_rddata_14);
-    OpenDDR.dfi_rddata_15(dfi_rddata_15);
+    OpenDDR.dfi_rddata(dfi_rddata);
 
     // Connect AXI Master
     axi_master.clk(axi_clk);
@@ -722,27 +649,15 @@ int sc_main(int argc, char* argv[]) {
     phy.dfi_wck_en(dfi_wck_en);
     phy.dfi_wck_toggle(dfi_wck_toggle);
     
-    phy.dfi_wrdata_0(dfi_wrdata_0);
-    phy.dfi_wrdata_1(dfi_wrdata_1);
-    phy.dfi_wrdata_2(dfi_wrdata_2);
-    phy.dfi_wrdata_3(dfi_wrdata_3);
-    phy.dfi_wrdata_mask_0(dfi_wrdata_mask_0);
-    phy.dfi_wrdata_mask_1(dfi_wrdata_mask_1);
-    phy.dfi_wrdata_mask_2(dfi_wrdata_mask_2);
-    phy.dfi_wrdata_mask_3(dfi_wrdata_mask_3);
-    phy.dfi_wrdata_en_0(dfi_wrdata_en_0);
-    phy.dfi_wrdata_en_1(dfi_wrdata_en_1);
-    phy.dfi_wrdata_en_2(dfi_wrdata_en_2);
-    phy.dfi_wrdata_en_3(dfi_wrdata_en_3);
+    phy.dfi_wrdata(dfi_wrdata);
+    phy.dfi_wrdata_mask(dfi_wrdata_mask);
+    phy.dfi_wrdata_en(dfi_wrdata_en);
     
     phy.mc_rdrst_b(mc_rdrst_b);
     phy.mc_rcv_en(mc_rcv_en);
     phy.dfi_rddata_en(dfi_rddata_en);
     phy.dfi_rddata_valid(dfi_rddata_valid);
-    phy.dfi_rddata_0(dfi_rddata_0);
-    phy.dfi_rddata_1(dfi_rddata_1);
-    phy.dfi_rddata_2(dfi_rddata_2);
-    phy.dfi_rddata_3(dfi_rddata_3);
+    phy.dfi_rddata(dfi_rddata);
 
     // Connect Reset Generator
     reset_gen.clk(mck);
@@ -772,8 +687,8 @@ int sc_main(int argc, char* argv[]) {
     // DFI traces
     sc_trace(tf, dfi_cs_0_p0, "dfi_cs_0_p0");
     sc_trace(tf, dfi_address_0_p0, "dfi_address_0_p0");
-    sc_trace(tf, dfi_wrdata_0, "dfi_wrdata_0");
-    sc_trace(tf, dfi_rddata_0, "dfi_rddata_0");
+    dfi_wrdata.trace(tf, "dfi_wrdata");
+    dfi_rddata.trace(tf, "dfi_rddata");
 
     std::cout << "Starting OpenDDR DDR SystemC Model Simulation..." << std::endl;
     
@@ -784,6 +699,7 @@ int sc_main(int argc, char* argv[]) {
     OpenDDR.print_statistics();
     
     sc_close_vcd_trace_file(tf);
+    OpenDDRLog::stop_binary_sink();
     
     std::cout << "Simulation completed successfully!" << std::endl;
     return 0;
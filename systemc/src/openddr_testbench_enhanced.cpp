@@ -1,9 +1,17 @@
 #include "openddr_systemc_model_enhanced.h"
+#include "openddr_log.h"
+#include "openddr_seed.h"
 #include <systemc.h>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 #include <random>
+#include <chrono>
+#include <fstream>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
 
 // Enhanced testbench for OpenDDR DDR SystemC Model with ALL verification disabled
 SC_MODULE(OpenDDRTestbenchEnhanced) {
@@ -93,82 +101,17 @@ SC_MODULE(OpenDDRTestbenchEnhanced) {
     sc_signal<sc_uint<4>> dfi_wck_en;
     sc_signal<sc_uint<2>> dfi_wck_toggle;
 
-    // DFI Write Data Interface
-    sc_signal<sc_uint<32>> dfi_wrdata_0;
-    sc_signal<sc_uint<32>> dfi_wrdata_1;
-    sc_signal<sc_uint<32>> dfi_wrdata_2;
-    sc_signal<sc_uint<32>> dfi_wrdata_3;
-    sc_signal<sc_uint<32>> dfi_wrdata_4;
-    sc_signal<sc_uint<32>> dfi_wrdata_5;
-    sc_signal<sc_uint<32>> dfi_wrdata_6;
-    sc_signal<sc_uint<32>> dfi_wrdata_7;
-    sc_signal<sc_uint<32>> dfi_wrdata_8;
-    sc_signal<sc_uint<32>> dfi_wrdata_9;
-    sc_signal<sc_uint<32>> dfi_wrdata_10;
-    sc_signal<sc_uint<32>> dfi_wrdata_11;
-    sc_signal<sc_uint<32>> dfi_wrdata_12;
-    sc_signal<sc_uint<32>> dfi_wrdata_13;
-    sc_signal<sc_uint<32>> dfi_wrdata_14;
-    sc_signal<sc_uint<32>> dfi_wrdata_15;
-
-    // DFI Write Data Mask
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_15;
-
-    // DFI Write Data Enable
-    sc_signal<sc_uint<4>> dfi_wrdata_en_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_15;
+    // DFI Write Data Interface (data, mask and enable for all 16 phases)
+    DFIDataSignal<32> dfi_wrdata;
+    DFIDataSignal<4> dfi_wrdata_mask;
+    DFIDataSignal<4> dfi_wrdata_en;
 
     // DFI Read Data Interface
     sc_signal<bool> mc_rdrst_b;
     sc_signal<bool> mc_rcv_en;
     sc_signal<bool> dfi_rddata_en;
     sc_signal<bool> dfi_rddata_valid;
-
-    sc_signal<sc_uint<32>> dfi_rddata_0;
-    sc_signal<sc_uint<32>> dfi_rddata_1;
-    sc_signal<sc_uint<32>> dfi_rddata_2;
-    sc_signal<sc_uint<32>> dfi_rddata_3;
-    sc_signal<sc_uint<32>> dfi_rddata_4;
-    sc_signal<sc_uint<32>> dfi_rddata_5;
-    sc_signal<sc_uint<32>> dfi_rddata_6;
-    sc_signal<sc_uint<32>> dfi_rddata_7;
-    sc_signal<sc_uint<32>> dfi_rddata_8;
-    sc_signal<sc_uint<32>> dfi_rddata_9;
-    sc_signal<sc_uint<32>> dfi_rddata_10;
-    sc_signal<sc_uint<32>> dfi_rddata_11;
-    sc_signal<sc_uint<32>> dfi_rddata_12;
-    sc_signal<sc_uint<32>> dfi_rddata_13;
-    sc_signal<sc_uint<32>> dfi_rddata_14;
-    sc_signal<sc_uint<32>> dfi_rddata_15;
+    DFIDataSignal<32> dfi_rddata;
 
     // DUT instance
     OpenDDRSystemCModelEnhanced* dut;
@@ -181,18 +124,33 @@ SC_MODULE(OpenDDRTestbenchEnhanced) {
     int test_passed;
     int current_test_id;
 
+    // The reset sequence is over and stimulus has not started yet; a
+    // checkpoint is restored at this point (--restore-checkpoint)
+    static constexpr double RESET_DONE_NS = 175;
+
+    // APB register writes applied after reset (--reg ADDR=VALUE)
+    std::vector<std::pair<uint32_t, uint32_t>> register_overrides;
+
     // Constructor
-    SC_CTOR(OpenDDRTestbenchEnhanced) : 
+    SC_HAS_PROCESS(OpenDDRTestbenchEnhanced);
+    OpenDDRTestbenchEnhanced(sc_module_name name, const ModelConfig& cfg = ModelConfig(),
+                             const std::vector<std::pair<uint32_t, uint32_t>>& regs = {}) :
+        sc_module(name),
         mck("mck", 5, SC_NS),           // 200MHz main clock
         slow_clk("slow_clk", 40, SC_NS), // 25MHz slow clock
         mc0_aclk("mc0_aclk", 5, SC_NS),  // 200MHz AXI clock
-        random_gen(std::random_device{}()),
+        dfi_wrdata("dfi_wrdata"),
+        dfi_wrdata_mask("dfi_wrdata_mask"),
+        dfi_wrdata_en("dfi_wrdata_en"),
+        dfi_rddata("dfi_rddata"),
+        random_gen(OpenDDRSeed::rng(this->name())),
         test_errors(0),
         test_passed(0),
-        current_test_id(0)
+        current_test_id(0),
+        register_overrides(regs)
     {
         // Create DUT instance
-        dut = new OpenDDRSystemCModelEnhanced("dut");
+        dut = new OpenDDRSystemCModelEnhanced("dut", cfg);
 
         // Connect all signals
         connect_signals();
@@ -331,81 +289,17 @@ void OpenDDRTestbenchEnhanced::connect_signals() {
     dut->dfi_wck_en(dfi_wck_en);
     dut->dfi_wck_toggle(dfi_wck_toggle);
 
-    // Connect DFI Write Data Interface (first 4 phases for simplicity)
-    dut->dfi_wrdata_0(dfi_wrdata_0);
-    dut->dfi_wrdata_1(dfi_wrdata_1);
-    dut->dfi_wrdata_2(dfi_wrdata_2);
-    dut->dfi_wrdata_3(dfi_wrdata_3);
-    dut->dfi_wrdata_4(dfi_wrdata_4);
-    dut->dfi_wrdata_5(dfi_wrdata_5);
-    dut->dfi_wrdata_6(dfi_wrdata_6);
-    dut->dfi_wrdata_7(dfi_wrdata_7);
-    dut->dfi_wrdata_8(dfi_wrdata_8);
-    dut->dfi_wrdata_9(dfi_wrdata_9);
-    dut->dfi_wrdata_10(dfi_wrdata_10);
-    dut->dfi_wrdata_11(dfi_wrdata_11);
-    dut->dfi_wrdata_12(dfi_wrdata_12);
-    dut->dfi_wrdata_13(dfi_wrdata_13);
-    dut->dfi_wrdata_14(dfi_wrdata_14);
-    dut->dfi_wrdata_15(dfi_wrdata_15);
-
-    // Connect DFI Write Data Masks and Enables (first 4 phases)
-    dut->dfi_wrdata_mask_0(dfi_wrdata_mask_0);
-    dut->dfi_wrdata_mask_1(dfi_wrdata_mask_1);
-    dut->dfi_wrdata_mask_2(dfi_wrdata_mask_2);
-    dut->dfi_wrdata_mask_3(dfi_wrdata_mask_3);
-    dut->dfi_wrdata_mask_4(dfi_wrdata_mask_4);
-    dut->dfi_wrdata_mask_5(dfi_wrdata_mask_5);
-    dut->dfi_wrdata_mask_6(dfi_wrdata_mask_6);
-    dut->dfi_wrdata_mask_7(dfi_wrdata_mask_7);
-    dut->dfi_wrdata_mask_8(dfi_wrdata_mask_8);
-    dut->dfi_wrdata_mask_9(dfi_wrdata_mask_9);
-    dut->dfi_wrdata_mask_10(dfi_wrdata_mask_10);
-    dut->dfi_wrdata_mask_11(dfi_wrdata_mask_11);
-    dut->dfi_wrdata_mask_12(dfi_wrdata_mask_12);
-    dut->dfi_wrdata_mask_13(dfi_wrdata_mask_13);
-    dut->dfi_wrdata_mask_14(dfi_wrdata_mask_14);
-    dut->dfi_wrdata_mask_15(dfi_wrdata_mask_15);
-
-    dut->dfi_wrdata_en_0(dfi_wrdata_en_0);
-    dut->dfi_wrdata_en_1(dfi_wrdata_en_1);
-    dut->dfi_wrdata_en_2(dfi_wrdata_en_2);
-    dut->dfi_wrdata_en_3(dfi_wrdata_en_3);
-    dut->dfi_wrdata_en_4(dfi_wrdata_en_4);
-    dut->dfi_wrdata_en_5(dfi_wrdata_en_5);
-    dut->dfi_wrdata_en_6(dfi_wrdata_en_6);
-    dut->dfi_wrdata_en_7(dfi_wrdata_en_7);
-    dut->dfi_wrdata_en_8(dfi_wrdata_en_8);
-    dut->dfi_wrdata_en_9(dfi_wrdata_en_9);
-    dut->dfi_wrdata_en_10(dfi_wrdata_en_10);
-    dut->dfi_wrdata_en_11(dfi_wrdata_en_11);
-    dut->dfi_wrdata_en_12(dfi_wrdata_en_12);
-    dut->dfi_wrdata_en_13(dfi_wrdata_en_13);
-    dut->dfi_wrdata_en_14(dfi_wrdata_en_14);
-    dut->dfi_wrdata_en_15(dfi_wrdata_en_15);
+    // Connect DFI Write Data Interface, masks and enables (all 16 phases)
+    dut->dfi_wrdata(dfi_wrdata);
+    dut->dfi_wrdata_mask(dfi_wrdata_mask);
+    dut->dfi_wrdata_en(dfi_wrdata_en);
 
     // Connect DFI Read Data Interface
     dut->mc_rdrst_b(mc_rdrst_b);
     dut->mc_rcv_en(mc_rcv_en);
     dut->dfi_rddata_en(dfi_rddata_en);
     dut->dfi_rddata_valid(dfi_rddata_valid);
-
-    dut->dfi_rddata_0(dfi_rddata_0);
-    dut->dfi_rddata_1(dfi_rddata_1);
-    dut->dfi_rddata_2(dfi_rddata_2);
-    dut->dfi_rddata_3(dfi_rddata_3);
-    dut->dfi_rddata_4(dfi_rddata_4);
-    dut->dfi_rddata_5(dfi_rddata_5);
-    dut->dfi_rddata_6(dfi_rddata_6);
-    dut->dfi_rddata_7(dfi_rddata_7);
-    dut->dfi_rddata_8(dfi_rddata_8);
-    dut->dfi_rddata_9(dfi_rddata_9);
-    dut->dfi_rddata_10(dfi_rddata_10);
-    dut->dfi_rddata_11(dfi_rddata_11);
-    dut->dfi_rddata_12(dfi_rddata_12);
-    dut->dfi_rddata_13(dfi_rddata_13);
-    dut->dfi_rddata_14(dfi_rddata_14);
-    dut->dfi_rddata_15(dfi_rddata_15);
+    dut->dfi_rddata(dfi_rddata);
 }
 
 void OpenDDRTestbenchEnhanced::initialize_signals() {
@@ -430,22 +324,8 @@ void OpenDDRTestbenchEnhanced::initialize_signals() {
     dfi_rddata_en.write(false);
     
     // Initialize all DFI read data to zero
-    dfi_rddata_0.write(0);
-    dfi_rddata_1.write(0);
-    dfi_rddata_2.write(0);
-    dfi_rddata_3.write(0);
-    dfi_rddata_4.write(0);
-    dfi_rddata_5.write(0);
-    dfi_rddata_6.write(0);
-    dfi_rddata_7.write(0);
-    dfi_rddata_8.write(0);
-    dfi_rddata_9.write(0);
-    dfi_rddata_10.write(0);
-    dfi_rddata_11.write(0);
-    dfi_rddata_12.write(0);
-    dfi_rddata_13.write(0);
-    dfi_rddata_14.write(0);
-    dfi_rddata_15.write(0);
+    const uint32_t rddata_idle[DFI_DATA_PHASES] = {};
+    dfi_rddata.write_lanes(rddata_idle);
 }
 
 void OpenDDRTestbenchEnhanced::initialize_test_vectors() {
@@ -503,6 +383,10 @@ void OpenDDRTestbenchEnhanced::stimulus_process() {
     // Wait for reset completion
     wait(200, SC_NS);
     
+    for (const auto& reg : register_overrides) {
+        apb_write(reg.first, reg.second);
+    }
+    
     std::cout << "@" << sc_time_stamp() << " Starting comprehensive test suite..." << std::endl;
     
     // Run comprehensive test suite - NO VERIFICATION
@@ -572,9 +456,9 @@ void OpenDDRTestbenchEnhanced::dfi_read_data_driver() {
         if (dfi_rddata_en.read()) {
             // Simulate read data return with some delay
             wait(20, SC_NS);
+            const uint32_t rddata[DFI_DATA_PHASES] = { 0x12345678, 0x9ABCDEF0 };
             dfi_rddata_valid.write(true);
-            dfi_rddata_0.write(0x12345678);
-            dfi_rddata_1.write(0x9ABCDEF0);
+            dfi_rddata.write_lanes(rddata);
             wait(5, SC_NS);
             dfi_rddata_valid.write(false);
         }
@@ -905,38 +789,191 @@ bool OpenDDRTestbenchEnhanced::verify_test_pattern(sc_uint<40> addr, sc_uint<64>
     return true;     // Always return true - NO VERIFICATION
 }
 
+static void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  -s, --set KEY=VALUE      Override a ModelConfig field, e.g. ddr_cmd_queue_depth=64" << std::endl;
+    std::cout << "  -r, --reg ADDR=VALUE     APB register write after reset, e.g. 0x020=0x0C0C0C0C" << std::endl;
+    std::cout << "  -t, --sim-time NS        Simulated time to run (default: 5000)" << std::endl;
+    std::cout << "  -j, --stats-json FILE    Write final model statistics as JSON" << std::endl;
+    std::cout << "  -n, --no-vcd             Do not write the VCD trace" << std::endl;
+    std::cout << "  -S, --save-checkpoint F  Save the model state to F at the end of the run" << std::endl;
+    std::cout << "  -R, --restore-checkpoint F  Restore the model state from F after reset, then run --sim-time more" << std::endl;
+    std::cout << "  -e, --seed N             Global random seed (default: OPENDDR_SEED or " << OpenDDRSeed::DEFAULT_SEED << ")" << std::endl;
+    std::cout << "  -h, --help               Show this help" << std::endl;
+}
+
+// Splits "KEY=VALUE"; VALUE may be decimal or 0x hex
+static bool parse_assignment(const char* arg, std::string& key, uint32_t& value) {
+    const char* eq = strchr(arg, '=');
+    if (eq == nullptr || eq == arg) {
+        return false;
+    }
+    char* end;
+    unsigned long v = strtoul(eq + 1, &end, 0);
+    if (*(eq + 1) == '\0' || *end != '\0' || v > 0xFFFFFFFFUL) {
+        return false;
+    }
+    key.assign(arg, eq - arg);
+    value = static_cast<uint32_t>(v);
+    return true;
+}
+
+// Main function for enhanced testbench
 // Main function for enhanced testbench
 int sc_main(int argc, char* argv[]) {
-    // Create trace file
-    sc_trace_file* tf = sc_create_vcd_trace_file("OpenDDR_trace_enhanced");
+    ModelConfig cfg;
+    std::vector<std::pair<uint32_t, uint32_t>> regs;
+    double sim_time_ns = 5000;
+    const char* stats_json = nullptr;
+    bool write_vcd = true;
+    const char* save_checkpoint = nullptr;
+    const char* restore_checkpoint = nullptr;
+
+    // --seed overrides OPENDDR_SEED; both must be set before any module exists
+    OpenDDRSeed::configure_from_env();
+
+    static struct option long_options[] = {
+        {"set",        required_argument, 0, 's'},
+        {"reg",        required_argument, 0, 'r'},
+        {"sim-time",   required_argument, 0, 't'},
+        {"stats-json", required_argument, 0, 'j'},
+        {"no-vcd",     no_argument,       0, 'n'},
+        {"save-checkpoint",    required_argument, 0, 'S'},
+        {"restore-checkpoint", required_argument, 0, 'R'},
+        {"seed",       required_argument, 0, 'e'},
+        {"help",       no_argument,       0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    int c;
+    std::string key;
+    uint32_t value;
+    while ((c = getopt_long(argc, argv, "s:r:t:j:nS:R:e:h", long_options, nullptr)) != -1) {
+        switch (c) {
+            case 's':
+                if (!parse_assignment(optarg, key, value) || !cfg.set(key.c_str(), value)) {
+                    std::cerr << "Error: Invalid --set " << optarg << std::endl;
+                    return 1;
+                }
+                break;
+
+            case 'r':
+                if (!parse_assignment(optarg, key, value)) {
+                    std::cerr << "Error: Invalid --reg " << optarg << std::endl;
+                    return 1;
+                }
+                regs.emplace_back(strtoul(key.c_str(), nullptr, 0) & 0x3FF, value);
+                break;
+
+            case 't':
+                sim_time_ns = atof(optarg);
+                break;
+
+            case 'j':
+                stats_json = optarg;
+                break;
+
+            case 'n':
+                write_vcd = false;
+                break;
+
+            case 'S':
+                save_checkpoint = optarg;
+                break;
+
+            case 'R':
+                restore_checkpoint = optarg;
+                break;
+
+            case 'e': {
+                uint64_t seed;
+                if (!OpenDDRSeed::parse(optarg, seed)) {
+                    std::cerr << "Error: Invalid --seed " << optarg << std::endl;
+                    return 1;
+                }
+                OpenDDRSeed::set_global(seed);
+                break;
+            }
+
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    // Logging is configured through OPENDDR_LOG_LEVEL/_CATEGORIES/_FILE
+    OpenDDRLog::configure_from_env();
     
     // Create testbench
-    OpenDDRTestbenchEnhanced tb("testbench");
+    OpenDDRTestbenchEnhanced tb("testbench", cfg, regs);
+    
+    // Create trace file
+    sc_trace_file* tf = write_vcd ? sc_create_vcd_trace_file("OpenDDR_trace_enhanced") : nullptr;
     
     // Add signals to trace
-    sc_trace(tf, tb.mck, "mck");
-    sc_trace(tf, tb.mc_rst_b, "mc_rst_b");
-    sc_trace(tf, tb.mc0_axi_awvalid, "mc0_axi_awvalid");
-    sc_trace(tf, tb.mc0_axi_awready, "mc0_axi_awready");
-    sc_trace(tf, tb.mc0_axi_awaddr, "mc0_axi_awaddr");
-    sc_trace(tf, tb.mc0_axi_wvalid, "mc0_axi_wvalid");
-    sc_trace(tf, tb.mc0_axi_wready, "mc0_axi_wready");
-    sc_trace(tf, tb.mc0_axi_wdata, "mc0_axi_wdata");
-    sc_trace(tf, tb.mc0_axi_bvalid, "mc0_axi_bvalid");
-    sc_trace(tf, tb.mc0_axi_bready, "mc0_axi_bready");
-    sc_trace(tf, tb.mc0_axi_arvalid, "mc0_axi_arvalid");
-    sc_trace(tf, tb.mc0_axi_arready, "mc0_axi_arready");
-    sc_trace(tf, tb.mc0_axi_rvalid, "mc0_axi_rvalid");
-    sc_trace(tf, tb.mc0_axi_rready, "mc0_axi_rready");
-    sc_trace(tf, tb.dfi_cs_0_p0, "dfi_cs_0_p0");
-    sc_trace(tf, tb.dfi_address_0_p0, "dfi_address_0_p0");
-    sc_trace(tf, tb.dfi_wrdata_0, "dfi_wrdata_0");
+    if (tf != nullptr) {
+        sc_trace(tf, tb.mck, "mck");
+        sc_trace(tf, tb.mc_rst_b, "mc_rst_b");
+        sc_trace(tf, tb.mc0_axi_awvalid, "mc0_axi_awvalid");
+        sc_trace(tf, tb.mc0_axi_awready, "mc0_axi_awready");
+        sc_trace(tf, tb.mc0_axi_awaddr, "mc0_axi_awaddr");
+        sc_trace(tf, tb.mc0_axi_wvalid, "mc0_axi_wvalid");
+        sc_trace(tf, tb.mc0_axi_wready, "mc0_axi_wready");
+        sc_trace(tf, tb.mc0_axi_wdata, "mc0_axi_wdata");
+        sc_trace(tf, tb.mc0_axi_bvalid, "mc0_axi_bvalid");
+        sc_trace(tf, tb.mc0_axi_bready, "mc0_axi_bready");
+        sc_trace(tf, tb.mc0_axi_arvalid, "mc0_axi_arvalid");
+        sc_trace(tf, tb.mc0_axi_arready, "mc0_axi_arready");
+        sc_trace(tf, tb.mc0_axi_rvalid, "mc0_axi_rvalid");
+        sc_trace(tf, tb.mc0_axi_rready, "mc0_axi_rready");
+        sc_trace(tf, tb.dfi_cs_0_p0, "dfi_cs_0_p0");
+        sc_trace(tf, tb.dfi_address_0_p0, "dfi_address_0_p0");
+        tb.dfi_wrdata.trace(tf, "dfi_wrdata");
+    }
     
     // Run simulation
-    sc_start(5000, SC_NS);
+    std::string error;
+    if (restore_checkpoint != nullptr) {
+        sc_start(OpenDDRTestbenchEnhanced::RESET_DONE_NS, SC_NS);
+        if (!tb.dut->restore_checkpoint(restore_checkpoint, error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+    }
+    
+    auto wall_start = std::chrono::steady_clock::now();
+    sc_start(sim_time_ns, SC_NS);
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wall_start;
+    
+    if (save_checkpoint != nullptr && !tb.dut->save_checkpoint(save_checkpoint, error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    
+    if (stats_json != nullptr) {
+        ModelStatistics stats = tb.dut->statistics();
+        stats.seed = OpenDDRSeed::global();
+        stats.sim_time_ns = sc_time_stamp().to_seconds() * 1e9;
+        stats.wall_seconds = wall.count();
+        std::ofstream out(stats_json);
+        if (!out) {
+            std::cerr << "Error: Cannot write " << stats_json << std::endl;
+            return 1;
+        }
+        stats.write_json(out);
+    }
     
     // Close trace file
-    sc_close_vcd_trace_file(tf);
+    if (tf != nullptr) {
+        sc_close_vcd_trace_file(tf);
+    }
+    OpenDDRLog::stop_binary_sink();
     
     return 0;
 }
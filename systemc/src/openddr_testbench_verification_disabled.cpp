@@ -1,4 +1,6 @@
-#include "openddr_systemc_model_enhanced.h"
+#include "openddr_systemc_model_verification_disabled.h"
+#include "openddr_log.h"
+#include "openddr_seed.h"
 #include <systemc.h>
 #include <iostream>
 #include <iomanip>
@@ -93,85 +95,20 @@ SC_MODULE(openddrTestbenchEnhanced) {
     sc_signal<sc_uint<4>> dfi_wck_en;
     sc_signal<sc_uint<2>> dfi_wck_toggle;
 
-    // DFI Write Data Interface
-    sc_signal<sc_uint<32>> dfi_wrdata_0;
-    sc_signal<sc_uint<32>> dfi_wrdata_1;
-    sc_signal<sc_uint<32>> dfi_wrdata_2;
-    sc_signal<sc_uint<32>> dfi_wrdata_3;
-    sc_signal<sc_uint<32>> dfi_wrdata_4;
-    sc_signal<sc_uint<32>> dfi_wrdata_5;
-    sc_signal<sc_uint<32>> dfi_wrdata_6;
-    sc_signal<sc_uint<32>> dfi_wrdata_7;
-    sc_signal<sc_uint<32>> dfi_wrdata_8;
-    sc_signal<sc_uint<32>> dfi_wrdata_9;
-    sc_signal<sc_uint<32>> dfi_wrdata_10;
-    sc_signal<sc_uint<32>> dfi_wrdata_11;
-    sc_signal<sc_uint<32>> dfi_wrdata_12;
-    sc_signal<sc_uint<32>> dfi_wrdata_13;
-    sc_signal<sc_uint<32>> dfi_wrdata_14;
-    sc_signal<sc_uint<32>> dfi_wrdata_15;
-
-    // DFI Write Data Mask
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_mask_15;
-
-    // DFI Write Data Enable
-    sc_signal<sc_uint<4>> dfi_wrdata_en_0;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_1;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_2;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_3;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_4;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_5;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_6;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_7;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_8;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_9;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_10;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_11;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_12;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_13;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_14;
-    sc_signal<sc_uint<4>> dfi_wrdata_en_15;
+    // DFI Write Data Interface (data, mask and enable for all 16 phases)
+    DFIDataSignal<32> dfi_wrdata;
+    DFIDataSignal<4> dfi_wrdata_mask;
+    DFIDataSignal<4> dfi_wrdata_en;
 
     // DFI Read Data Interface
     sc_signal<bool> mc_rdrst_b;
     sc_signal<bool> mc_rcv_en;
     sc_signal<bool> dfi_rddata_en;
     sc_signal<bool> dfi_rddata_valid;
-
-    sc_signal<sc_uint<32>> dfi_rddata_0;
-    sc_signal<sc_uint<32>> dfi_rddata_1;
-    sc_signal<sc_uint<32>> dfi_rddata_2;
-    sc_signal<sc_uint<32>> dfi_rddata_3;
-    sc_signal<sc_uint<32>> dfi_rddata_4;
-    sc_signal<sc_uint<32>> dfi_rddata_5;
-    sc_signal<sc_uint<32>> dfi_rddata_6;
-    sc_signal<sc_uint<32>> dfi_rddata_7;
-    sc_signal<sc_uint<32>> dfi_rddata_8;
-    sc_signal<sc_uint<32>> dfi_rddata_9;
-    sc_signal<sc_uint<32>> dfi_rddata_10;
-    sc_signal<sc_uint<32>> dfi_rddata_11;
-    sc_signal<sc_uint<32>> dfi_rddata_12;
-    sc_signal<sc_uint<32>> dfi_rddata_13;
-    sc_signal<sc_uint<32>> dfi_rddata_14;
-    sc_signal<sc_uint<32>> dfi_rddata_15;
+    DFIDataSignal<32> dfi_rddata;
 
     // DUT instance
-    openddrSystemCModelEnhanced* dut;
+    OpenDDRSystemCModelVerificationDisabled* dut;
 
     // Test control variables
     std::mt19937 random_gen;
@@ -186,13 +123,17 @@ SC_MODULE(openddrTestbenchEnhanced) {
         mck("mck", 5, SC_NS),           // 200MHz main clock
         slow_clk("slow_clk", 40, SC_NS), // 25MHz slow clock
         mc0_aclk("mc0_aclk", 5, SC_NS),  // 200MHz AXI clock
-        random_gen(std::random_device{}()),
+        dfi_wrdata("dfi_wrdata"),
+        dfi_wrdata_mask("dfi_wrdata_mask"),
+        dfi_wrdata_en("dfi_wrdata_en"),
+        dfi_rddata("dfi_rddata"),
+        random_gen(OpenDDRSeed::rng(name())),
         test_errors(0),
         test_passed(0),
         current_test_id(0)
     {
         // Create DUT instance
-        dut = new openddrSystemCModelEnhanced("dut");
+        dut = new OpenDDRSystemCModelVerificationDisabled("dut");
 
         // Connect all signals
         connect_signals();
@@ -331,81 +272,17 @@ void openddrTestbenchEnhanced::connect_signals() {
     dut->dfi_wck_en(dfi_wck_en);
     dut->dfi_wck_toggle(dfi_wck_toggle);
 
-    // Connect DFI Write Data Interface (first 4 phases for simplicity)
-    dut->dfi_wrdata_0(dfi_wrdata_0);
-    dut->dfi_wrdata_1(dfi_wrdata_1);
-    dut->dfi_wrdata_2(dfi_wrdata_2);
-    dut->dfi_wrdata_3(dfi_wrdata_3);
-    dut->dfi_wrdata_4(dfi_wrdata_4);
-    dut->dfi_wrdata_5(dfi_wrdata_5);
-    dut->dfi_wrdata_6(dfi_wrdata_6);
-    dut->dfi_wrdata_7(dfi_wrdata_7);
-    dut->dfi_wrdata_8(dfi_wrdata_8);
-    dut->dfi_wrdata_9(dfi_wrdata_9);
-    dut->dfi_wrdata_10(dfi_wrdata_10);
-    dut->dfi_wrdata_11(dfi_wrdata_11);
-    dut->dfi_wrdata_12(dfi_wrdata_12);
-    dut->dfi_wrdata_13(dfi_wrdata_13);
-    dut->dfi_wrdata_14(dfi_wrdata_14);
-    dut->dfi_wrdata_15(dfi_wrdata_15);
-
-    // Connect DFI Write Data Masks and Enables (first 4 phases)
-    dut->dfi_wrdata_mask_0(dfi_wrdata_mask_0);
-    dut->dfi_wrdata_mask_1(dfi_wrdata_mask_1);
-    dut->dfi_wrdata_mask_2(dfi_wrdata_mask_2);
-    dut->dfi_wrdata_mask_3(dfi_wrdata_mask_3);
-    dut->dfi_wrdata_mask_4(dfi_wrdata_mask_4);
-    dut->dfi_wrdata_mask_5(dfi_wrdata_mask_5);
-    dut->dfi_wrdata_mask_6(dfi_wrdata_mask_6);
-    dut->dfi_wrdata_mask_7(dfi_wrdata_mask_7);
-    dut->dfi_wrdata_mask_8(dfi_wrdata_mask_8);
-    dut->dfi_wrdata_mask_9(dfi_wrdata_mask_9);
-    dut->dfi_wrdata_mask_10(dfi_wrdata_mask_10);
-    dut->dfi_wrdata_mask_11(dfi_wrdata_mask_11);
-    dut->dfi_wrdata_mask_12(dfi_wrdata_mask_12);
-    dut->dfi_wrdata_mask_13(dfi_wrdata_mask_13);
-    dut->dfi_wrdata_mask_14(dfi_wrdata_mask_14);
-    dut->dfi_wrdata_mask_15(dfi_wrdata_mask_15);
-
-    dut->dfi_wrdata_en_0(dfi_wrdata_en_0);
-    dut->dfi_wrdata_en_1(dfi_wrdata_en_1);
-    dut->dfi_wrdata_en_2(dfi_wrdata_en_2);
-    dut->dfi_wrdata_en_3(dfi_wrdata_en_3);
-    dut->dfi_wrdata_en_4(dfi_wrdata_en_4);
-    dut->dfi_wrdata_en_5(dfi_wrdata_en_5);
-    dut->dfi_wrdata_en_6(dfi_wrdata_en_6);
-    dut->dfi_wrdata_en_7(dfi_wrdata_en_7);
-    dut->dfi_wrdata_en_8(dfi_wrdata_en_8);
-    dut->dfi_wrdata_en_9(dfi_wrdata_en_9);
-    dut->dfi_wrdata_en_10(dfi_wrdata_en_10);
-    dut->dfi_wrdata_en_11(dfi_wrdata_en_11);
-    dut->dfi_wrdata_en_12(dfi_wrdata_en_12);
-    dut->dfi_wrdata_en_13(dfi_wrdata_en_13);
-    dut->dfi_wrdata_en_14(dfi_wrdata_en_14);
-    dut->dfi_wrdata_en_15(dfi_wrdata_en_15);
+    // Connect DFI Write Data Interface, masks and enables (all 16 phases)
+    dut->dfi_wrdata(dfi_wrdata);
+    dut->dfi_wrdata_mask(dfi_wrdata_mask);
+    dut->dfi_wrdata_en(dfi_wrdata_en);
 
     // Connect DFI Read Data Interface
     dut->mc_rdrst_b(mc_rdrst_b);
     dut->mc_rcv_en(mc_rcv_en);
     dut->dfi_rddata_en(dfi_rddata_en);
     dut->dfi_rddata_valid(dfi_rddata_valid);
-
-    dut->dfi_rddata_0(dfi_rddata_0);
-    dut->dfi_rddata_1(dfi_rddata_1);
-    dut->dfi_rddata_2(dfi_rddata_2);
-    dut->dfi_rddata_3(dfi_rddata_3);
-    dut->dfi_rddata_4(dfi_rddata_4);
-    dut->dfi_rddata_5(dfi_rddata_5);
-    dut->dfi_rddata_6(dfi_rddata_6);
-    dut->dfi_rddata_7(dfi_rddata_7);
-    dut->dfi_rddata_8(dfi_rddata_8);
-    dut->dfi_rddata_9(dfi_rddata_9);
-    dut->dfi_rddata_10(dfi_rddata_10);
-    dut->dfi_rddata_11(dfi_rddata_11);
-    dut->dfi_rddata_12(dfi_rddata_12);
-    dut->dfi_rddata_13(dfi_rddata_13);
-    dut->dfi_rddata_14(dfi_rddata_14);
-    dut->dfi_rddata_15(dfi_rddata_15);
+    dut->dfi_rddata(dfi_rddata);
 }
 
 void openddrTestbenchEnhanced::initialize_signals() {
@@ -430,22 +307,8 @@ void openddrTestbenchEnhanced::initialize_signals() {
     dfi_rddata_en.write(false);
     
     // Initialize all DFI read data to zero
-    dfi_rddata_0.write(0);
-    dfi_rddata_1.write(0);
-    dfi_rddata_2.write(0);
-    dfi_rddata_3.write(0);
-    dfi_rddata_4.write(0);
-    dfi_rddata_5.write(0);
-    dfi_rddata_6.write(0);
-    dfi_rddata_7.write(0);
-    dfi_rddata_8.write(0);
-    dfi_rddata_9.write(0);
-    dfi_rddata_10.write(0);
-    dfi_rddata_11.write(0);
-    dfi_rddata_12.write(0);
-    dfi_rddata_13.write(0);
-    dfi_rddata_14.write(0);
-    dfi_rddata_15.write(0);
+    const uint32_t rddata_idle[DFI_DATA_PHASES] = {};
+    dfi_rddata.write_lanes(rddata_idle);
 }
 
 void openddrTestbenchEnhanced::initialize_test_vectors() {
@@ -572,9 +435,9 @@ void openddrTestbenchEnhanced::dfi_read_data_driver() {
         if (dfi_rddata_en.read()) {
             // Simulate read data return with some delay
             wait(20, SC_NS);
+            const uint32_t rddata[DFI_DATA_PHASES] = { 0x12345678, 0x9ABCDEF0 };
             dfi_rddata_valid.write(true);
-            dfi_rddata_0.write(0x12345678);
-            dfi_rddata_1.write(0x9ABCDEF0);
+            dfi_rddata.write_lanes(rddata);
             wait(5, SC_NS);
             dfi_rddata_valid.write(false);
         }
@@ -907,6 +770,11 @@ bool openddrTestbenchEnhanced::verify_test_pattern(sc_uint<40> addr, sc_uint<64>
 
 // Main function for enhanced testbench
 int sc_main(int argc, char* argv[]) {
+    // Logging is configured through OPENDDR_LOG_LEVEL/_CATEGORIES/_FILE
+    OpenDDRLog::configure_from_env();
+    // Random streams derive from OPENDDR_SEED (see openddr_seed.h)
+    OpenDDRSeed::configure_from_env();
+    
     // Create trace file
     sc_trace_file* tf = sc_create_vcd_trace_file("openddr_trace_enhanced");
     
@@ -930,13 +798,14 @@ int sc_main(int argc, char* argv[]) {
     sc_trace(tf, tb.mc0_axi_rready, "mc0_axi_rready");
     sc_trace(tf, tb.dfi_cs_0_p0, "dfi_cs_0_p0");
     sc_trace(tf, tb.dfi_address_0_p0, "dfi_address_0_p0");
-    sc_trace(tf, tb.dfi_wrdata_0, "dfi_wrdata_0");
+    tb.dfi_wrdata.trace(tf, "dfi_wrdata");
     
     // Run simulation
     sc_start(5000, SC_NS);
     
     // Close trace file
     sc_close_vcd_trace_file(tf);
+    OpenDDRLog::stop_binary_sink();
     
     return 0;
 }
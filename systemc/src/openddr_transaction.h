@@ -0,0 +1,135 @@
+#ifndef OPENDDR_TRANSACTION_H
+#define OPENDDR_TRANSACTION_H
+
+// Hot-path descriptors shared by the OpenDDR models.
+//
+// Both structs are plain, trivially copyable integers so they move through
+// the model queues as a couple of cache-line-sized copies.  Times are kept as
+// mck cycle counts; the write payload (16 DFI phases of data and mask) lives
+// in a DDRPayloadPool and commands only carry its 16-bit handle.
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// AXI transaction (address or data beat), 32 bytes
+struct AXITransaction {
+    uint64_t addr = 0;          // 40-bit AXI address
+    uint64_t data = 0;          // One 64-bit data beat
+    uint64_t issue_cycle = 0;   // mck cycle the beat was accepted
+    uint16_t id = 0;            // 12-bit AXI ID
+    uint8_t len = 0;
+    uint8_t strb = 0;
+    uint8_t size = 0;
+    uint8_t burst = 0;
+    uint8_t resp = 0;
+    uint8_t last : 1;
+    uint8_t is_write : 1;
+    uint8_t completed : 1;
+
+    AXITransaction() : last(0), is_write(0), completed(0) {}
+};
+static_assert(sizeof(AXITransaction) == 32, "AXITransaction must stay 32 bytes");
+static_assert(std::is_trivially_copyable<AXITransaction>::value, "AXITransaction must be trivially copyable");
+
+// Write payload for one DDR write command (16 DFI phases)
+struct DDRPayload {
+    uint32_t data[16];
+    uint8_t mask[16];
+};
+
+// DDR command, 32 bytes
+struct DDRCommand {
+    enum CommandType : uint8_t {
+        CMD_NOP = 0,
+        CMD_ACT = 1,
+        CMD_READ = 2,
+        CMD_WRITE = 3,
+        CMD_PRE = 4,
+        CMD_PREA = 5,
+        CMD_REF = 6,
+        CMD_MRS = 7,
+        CMD_MPC = 8,
+        CMD_SLFR_ENTRY = 9,
+        CMD_SLFR_EXIT = 10,
+        CMD_WCK_SYNC = 11,
+        CMD_WCK_TOGGLE = 12
+    };
+
+    static const uint16_t NO_PAYLOAD = 0xFFFF;
+
+    uint64_t original_addr = 0; // For verification
+    uint64_t issue_cycle = 0;   // mck cycle the command was scheduled
+    uint16_t row = 0;
+    uint16_t col = 0;
+    uint16_t payload = NO_PAYLOAD;  // DDRPayloadPool handle (writes only)
+    CommandType cmd_type = CMD_NOP;
+    uint8_t rank = 0;
+    uint8_t bank = 0;
+    uint8_t buf_index = 0;
+    uint8_t mrs_data = 0;       // For MRS commands
+    bool auto_precharge = false;
+};
+static_assert(sizeof(DDRCommand) <= 32, "DDRCommand must fit in 32 bytes");
+static_assert(std::is_trivially_copyable<DDRCommand>::value, "DDRCommand must be trivially copyable");
+
+// Fixed pool of write payloads addressed by 16-bit handles.  All storage is
+// allocated up front; alloc() returns NO_PAYLOAD when the pool is exhausted.
+class DDRPayloadPool {
+public:
+    explicit DDRPayloadPool(uint16_t capacity = 128)
+        : slots(capacity), free_list(capacity) {
+        for (uint16_t i = 0; i < capacity; i++) {
+            free_list[i] = static_cast<uint16_t>(capacity - 1 - i);
+        }
+    }
+
+    uint16_t alloc() {
+        if (free_list.empty()) {
+            return DDRCommand::NO_PAYLOAD;
+        }
+        uint16_t handle = free_list.back();
+        free_list.pop_back();
+        memset(&slots[handle], 0, sizeof(DDRPayload));
+        return handle;
+    }
+
+    void release(uint16_t handle) {
+        if (handle < slots.size()) {
+            free_list.push_back(handle);
+        }
+    }
+
+    void reset() {
+        free_list.clear();
+        for (size_t i = slots.size(); i > 0; i--) {
+            free_list.push_back(static_cast<uint16_t>(i - 1));
+        }
+    }
+
+    DDRPayload& operator[](uint16_t handle) { return slots[handle]; }
+    const DDRPayload& operator[](uint16_t handle) const { return slots[handle]; }
+
+    size_t capacity() const { return slots.size(); }
+    size_t in_use() const { return slots.size() - free_list.size(); }
+
+    // Raw state for checkpoints
+    const DDRPayload* payloads() const { return slots.data(); }
+    const std::vector<uint16_t>& free_handles() const { return free_list; }
+
+    bool restore(const DDRPayload* payload_data, size_t count, const uint16_t* free_data, size_t free_count) {
+        if (count != slots.size() || free_count > slots.size()) {
+            return false;
+        }
+        memcpy(slots.data(), payload_data, count * sizeof(DDRPayload));
+        free_list.assign(free_data, free_data + free_count);
+        return true;
+    }
+
+private:
+    std::vector<DDRPayload> slots;
+    std::vector<uint16_t> free_list;  // Never grows past capacity
+};
+
+#endif // OPENDDR_TRANSACTION_H